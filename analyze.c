@@ -15,6 +15,10 @@
 static int location = 0;
 static char * scope = "~";
 
+/* words of the frame taken by the locals of the
+   blocks enclosing the current one */
+static int frameDepth = 0;
+
 char * getNewScope(TreeNode * t)
 { char *result = NULL;
   if (t->nodekind == StmtK)
@@ -48,6 +52,7 @@ static void traverse( TreeNode * t,
     { int i;
       char * scopeBackup = scope;
       int locationBackup = location;
+      int frameDepthBackup = frameDepth;
       scope = getNewScope(t);
       location = 0;
 
@@ -57,6 +62,7 @@ static void traverse( TreeNode * t,
       free(scope);
       scope = scopeBackup;
       location = locationBackup;
+      frameDepth = frameDepthBackup;
     }
     postProc(t);
     traverse(t->sibling,preProc,postProc);
@@ -72,19 +78,49 @@ static void nullProc(TreeNode * t)
   else return;
 }
 
+/* Function declare makes the symbol of the
+ * declaration t just inserted in the symbol table
+ * and annotates t with it. Locals are stacked in
+ * the frame below those of the enclosing blocks
+ */
+static void declare( TreeNode * t)
+{ BucketList l = st_lookup_excluding_parent(scope,t->attr.name);
+  Symbol * sym = (Symbol *) malloc(sizeof(Symbol));
+  sym->name = t->attr.name;
+  sym->offset = l->memloc;
+  sym->size = 1;
+  if (t->nodekind == StmtK || strcmp(scope,"~") == 0)
+    sym->storage = GlobalS;
+  else if (t->kind.exp == SingleParamK || t->kind.exp == ArrayParamK)
+    sym->storage = ParamS;
+  else
+  { sym->storage = LocalS;
+    if (t->kind.exp == VarArrayK)
+      sym->size = t->child[0]->attr.val;
+    frameDepth += sym->size;
+    sym->offset = -frameDepth;
+  }
+  l->sym = sym;
+  t->sym = sym;
+}
+
 /* Procedure insertNode inserts 
  * identifiers stored in t into 
  * the symbol table 
  */
 static void insertNode( TreeNode * t)
 { int isArray = 0;
+  BucketList l;
   switch (t->nodekind)
   { case StmtK:
       switch (t->kind.stmt)
       { case FunctionK:
           if (st_lookup(scope,t->attr.name) == NULL)
           /* not yet in table, so treat as new definition */
-            st_insert(scope,t->attr.name,t->type,t->lineno,location++, isArray);
+          { st_insert(scope,t->attr.name,t->type,t->lineno,location++, isArray);
+            declare(t);
+            frameDepth = 0;
+          }
           else
           /* already in table, so ignore location, 
              add line number of use only */ 
@@ -108,6 +144,7 @@ static void insertNode( TreeNode * t)
             st_insert(scope,t->attr.name,t->type,t->lineno,location++, isArray);
             if(t->kind.exp == VarArrayK)
               location += t->child[0]->attr.val - 1;
+            declare(t);
           }
           else if(t->attr.name != NULL)
           /* already in table, so ignore location, 
@@ -118,10 +155,14 @@ static void insertNode( TreeNode * t)
         case IdK:
         case IdArrayK:
         case CallK:
-          if (st_lookup(scope,t->attr.name) == NULL)
-            fprintf(listing, "error:%d: %s is not declared\n", t->lineno, t->attr.name);
+          l = st_lookup(scope,t->attr.name);
+          if (l == NULL)
+          { fprintf(listing, "error:%d: %s is not declared\n", t->lineno, t->attr.name);
+            Error = TRUE;
+          }
           else
           {
+            t->sym = l->sym;
             if(checkArray(scope, t->attr.name) == 1)
               t->kind.exp = IdArrayK;
             addline(scope,t->attr.name,t->lineno,0);
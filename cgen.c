@@ -8,9 +8,13 @@
 /****************************************************/
 
 #include "globals.h"
+#include "util.h"
 #include "symtab.h"
 #include "code.h"
 #include "cgen.h"
+#include "regalloc.h"
+#include "optimize.h"
+#include "profile.h"
 
 /* tmpOffset is the memory offset for temps
    It is decremented each time a temp is
@@ -19,31 +23,92 @@
 static int tmpOffset = 0;
 static int numberOfArguments = 0;
 
-int forFunctionTable = 0;
-int locMain;
+/* numberOfParameters is the parameter count of the
+   function being generated; its RET pops them
+*/
+static int numberOfParameters = 0;
+
+/* Locals of all blocks of a function share one
+   frame below fp at negative offsets, allocated
+   by ENTER and laid out by regalloc
+*/
+
+/* TEMPREGS is the set of registers expression
+   temporaries are allocated from
+*/
+#define TEMPREGS ((1 << ac) | (1 << ac1) | (1 << ac2) | (1 << ac3))
+
+/* CALLNEED is the register need of a call: it
+   clobbers every register, so anything live
+   across it is spilled
+*/
+#define CALLNEED 100
+
+/* tempRegs is TEMPREGS less the registers the
+   current function keeps variables in
+*/
+static int tempRegs = TEMPREGS;
+
+/* functionLabel holds the label of each function,
+   indexed by its global location; calls to a
+   function not yet generated wait on it
+*/
+static int * functionLabel = NULL;
 
-static char* localNameStack[1024];
-static int localNameStackIndex = 1024;
-static char* parameterStack[1024];
-static int parameterStackIndex = 1024;
 
 /* prototype for internal recursive code generator */
 static void cGen (TreeNode * tree);
 static int pushArguments(int depth, TreeNode * tree);
-static int pushParameters(char *name);
-static int getLocalNameOffset(char *name);
-static int getParameterOffset(char *name);
-static void insertFunction(int functionLocation, char *name);
+static int countParameters(TreeNode * params);
+static void genVar(TmOp op, int r, Symbol *sym, char *comment);
 static void genExp( TreeNode * tree);
+static void genExpTo( TreeNode * tree, int t, int avail);
+static void genAssign( TreeNode * tree, int t, int avail, int needed);
+static void genOperands(TreeNode * p1, TreeNode * p2, int t, int avail,
+                        int * left, int * right);
+static int idRegister(TreeNode * tree);
+static int genSource(TreeNode * tree, int t, int avail);
+static int log2Const(TreeNode * tree);
+static TmOp genCond(TreeNode * tree, int sense, int * reg);
 static void genStmt( TreeNode * tree);
+static void genTailCall(TreeNode * tree);
+
+/* Function thenIsHot returns TRUE if the profile
+ * has the test of if statement tree holding more
+ * often than it fails
+ */
+static int thenIsHot(TreeNode * tree)
+{ int yes, no;
+  char text[80];
+  if (!ProfileUse || !branchCount(tree, &yes, &no) || yes <= no)
+    return FALSE;
+  sprintf(text, "then part laid out last, %d times true to %d", yes, no);
+  profileDecision(tree->lineno, text);
+  return TRUE;
+}
+
+/* Function bodyIsCold returns TRUE if the profile
+ * has while loop tree entered more often than its
+ * body runs
+ */
+static int bodyIsCold(TreeNode * tree)
+{ int yes, no;
+  char text[80];
+  if (!ProfileUse || !branchCount(tree, &yes, &no) || yes >= no)
+    return FALSE;
+  sprintf(text, "loop tested at the top, %d iterations in %d entries",
+          yes, no);
+  profileDecision(tree->lineno, text);
+  return TRUE;
+}
 
 /* Procedure genStmt generates code at a statement node */
 void genStmt( TreeNode * tree)
 { TreeNode * p1, * p2, * p3;
-  int savedLoc1,savedLoc2,currentLoc;
-  int loc;
+  int elseLabel, endLabel, testLabel, bodyLabel, thenLabel, exitLabel;
+  int reg;
+  TmOp op;
   char comment[128];
-  int tmpSize = 0;
   if(tree == NULL)
     return;
   switch (tree->kind.stmt) {
@@ -53,116 +118,520 @@ void genStmt( TreeNode * tree)
          p1 = tree->child[0] ;
          p2 = tree->child[1] ;
          p3 = tree->child[2] ;
+         if (p3 != NULL && thenIsHot(tree))
+         { /* the arm that ends in no jump goes
+              last, so make it the hot then part */
+           thenLabel = newLabel();
+           endLabel = newLabel();
+           op = genCond(p1, TRUE, &reg);
+           if (ProfileGenerate) probeBranch(tree, TRUE);
+           emitJump(op, reg, thenLabel, "if: jmp to then");
+           cGen(p3);
+           emitGoto(endLabel, "jmp to end");
+           placeLabel(thenLabel);
+           cGen(p2);
+           placeLabel(endLabel);
+           if (TraceCode)  emitComment("<- if end") ;
+           break;
+         }
          /* generate code for test expression */
-         genExp(p1);
-         savedLoc1 = emitSkip(1) ;
-         emitComment("if: jump to else belongs here");
+         elseLabel = newLabel();
+         op = genCond(p1, FALSE, &reg);
+         if (ProfileGenerate) probeBranch(tree, FALSE);
+         emitJump(op, reg, elseLabel, "if: jmp to else");
          /* recurse on then part */
-         genStmt(p2);
-         savedLoc2 = emitSkip(1) ;
-         emitComment("if: jump to end belongs here");
-         currentLoc = emitSkip(0) ;
-         emitBackup(savedLoc1) ;
-         emitRM_Abs("JEQ",ac,currentLoc,"if: jmp to else");
-         emitRestore() ;
-         /* recurse on else part */
-         genStmt(p3);
-         currentLoc = emitSkip(0) ;
-         emitBackup(savedLoc2) ;
-         emitRM_Abs("LDA",pc,currentLoc,"jmp to end") ;
-         emitRestore() ;
+         cGen(p2);
+         if (p3 != NULL)
+         {
+           endLabel = newLabel();
+           emitGoto(endLabel, "jmp to end");
+           placeLabel(elseLabel);
+           /* recurse on else part */
+           cGen(p3);
+           placeLabel(endLabel);
+         }
+         else
+           placeLabel(elseLabel);
          if (TraceCode)  emitComment("<- if end") ;
          break; /* if_k */
 
       case FunctionK:
-         sprintf(comment, "-> function declaration %s", tree->attr.name);
-         if (TraceCode) emitComment(comment);
-         savedLoc1 = emitSkip(0);
-         insertFunction(savedLoc1, tree->attr.name);
-         if(strcmp(tree->attr.name, "main") == 0)
-           locMain = savedLoc1;
-         if(strcmp(tree->attr.name, "input") == 0)
-           emitRO("IN",ac,0,0,"read integer value");
-         else if(strcmp(tree->attr.name, "output") == 0)
-         { emitRM("LD", ac, 1, fp, "load first argument");
-           /* now output it */
-           emitRO("OUT",ac,0,0,"write ac");
+         if (TraceCode)
+         { sprintf(comment, "-> function declaration %s", tree->attr.name);
+           emitComment(comment);
          }
-         else
+         placeLabel(functionLabel[tree->sym->offset]);
+         numberOfParameters = countParameters(tree->child[0]);
+         if (!emitBuiltin(tree->attr.name))
          {
-           int numberOfParameters = pushParameters(tree->attr.name);
+           allocRegisters(tree);
+           emitRM(opENTER, fp, frameSlots(), mp, "push fp and allocate frame");
+           tempRegs = TEMPREGS & ~varRegisters();
+           for(p1 = tree->child[0]; p1 != NULL; p1 = p1->sibling)
+             if(p1->sym != NULL && varRegister(p1->sym) >= 0)
+             {
+               if (TraceCode)
+               { sprintf(comment, "register %d holds %s",
+                         varRegister(p1->sym), p1->attr.name);
+                 emitComment(comment);
+               }
+               if(liveAtEntry(p1->sym))
+                 genVar(opLD, varRegister(p1->sym), p1->sym,
+                        "load parameter into register");
+             }
            genStmt(tree->child[1]);
-           parameterStackIndex += numberOfParameters;
+           /* a body ending in a return needs no other */
+           p1 = tree->child[1]->child[1];
+           while (p1 != NULL && p1->sibling != NULL)
+             p1 = p1->sibling;
+           if (p1 == NULL || p1->nodekind != StmtK || p1->kind.stmt != ReturnK)
+             emitReturn(numberOfParameters);
+         }
+         if (TraceCode)
+         { sprintf(comment, "<- function declaration %s end", tree->attr.name);
+           emitComment(comment);
          }
-         emitRM("LDA", mp, 0, fp, "copy fp to sp");
-         emitRM("LD", fp, 0, mp, "pop fp");
-         emitRM("LDC", ac1, 1, 0, "ac1 = 1");
-         emitRO("ADD", mp, mp, ac1, "mp = mp + ac1");
-         if(strcmp(tree->attr.name, "main") != 0) //메인이면 마지막 HALT로 
-           emitRM("LD", pc, -2, mp, "jump to return address");
-         sprintf(comment, "<- function declaration %s end", tree->attr.name);
-         if (TraceCode) emitComment(comment);
          break;
       case CompoundK:
-         sprintf(comment, "-> compound %d start", tree->lineno);
-         if (TraceCode) emitComment(comment);
+         if (TraceCode)
+         { sprintf(comment, "-> compound %d start", tree->lineno);
+           emitComment(comment);
+         }
          p1 = tree->child[0];
          p2 = tree->child[1];
-         tmpSize = 0;
          while(p1 != NULL)
          {
-           if(p1->kind.exp == VarK)
-           {
-             tmpSize += 1;
-             localNameStack[--localNameStackIndex] = p1->attr.name;
-           }
-           else
-           {
-             tmpSize += p1->child[0]->attr.val;
-             localNameStackIndex -= p1->child[0]->attr.val;
-             localNameStack[localNameStackIndex] = p1->attr.name;
+           if (TraceCode)
+           { if(varRegister(p1->sym) >= 0)
+               sprintf(comment, "register %d holds %s",
+                       varRegister(p1->sym), p1->attr.name);
+             else
+               sprintf(comment, "%s is at %d(fp)", p1->attr.name, p1->sym->offset);
+             emitComment(comment);
            }
            p1 = p1->sibling;
          }
-         emitRM("LDC", ac1, tmpSize, 0, "ac1 = sum of size of local variables");
-         emitRO("SUB", mp, mp, ac1, "allocate local variables");
          cGen(p2);
-         emitRM("LDC", ac1, tmpSize, 0, "ac1 = sum of size of local variables");
-         emitRO("ADD", mp, mp, ac1, "free local variable");
-         localNameStackIndex += tmpSize;
-         sprintf(comment, "<- compound %d end", tree->lineno);
-         if (TraceCode) emitComment(comment);
+         if (TraceCode)
+         { sprintf(comment, "<- compound %d end", tree->lineno);
+           emitComment(comment);
+         }
          break;
       case WhileK:
          if (TraceCode) emitComment("-> while start") ;
          p1 = tree->child[0];
          p2 = tree->child[1];
-         savedLoc1 = emitSkip(0);
-         if (TraceCode) emitComment("while : test expression start");
-         genExp(p1);
-         if (TraceCode) emitComment("while : test expression end");
-         savedLoc2 = emitSkip(1);
+         testLabel = newLabel();
+         if (!passEnabled("rotate-loops") || bodyIsCold(tree))
+         { /* the loop is mostly skipped: test at
+              the top, so it is left in one jump */
+           exitLabel = newLabel();
+           placeLabel(testLabel);
+           op = genCond(p1, FALSE, &reg);
+           if (ProfileGenerate) probeBranch(tree, FALSE);
+           emitJump(op, reg, exitLabel, "while : false");
+           cGen(p2);
+           emitGoto(testLabel, "while : jump to test");
+           placeLabel(exitLabel);
+           if (TraceCode) emitComment("<- while end");
+           break;
+         }
+         /* the test goes after the body, so each
+            iteration ends in one conditional jump */
+         bodyLabel = newLabel();
+         emitGoto(testLabel, "while : jump to test");
+         placeLabel(bodyLabel);
          if (TraceCode) emitComment("while : body start");
-         genStmt(p2);
+         cGen(p2);
          if (TraceCode) emitComment("while : body end");
-         emitRM("LDC", pc, savedLoc1, 0, "unconditional jump");
-         currentLoc = emitSkip(0);
-         emitBackup(savedLoc2);
-         emitRM_Abs("JEQ", ac, currentLoc, "while : false");
-         emitRestore();
+         placeLabel(testLabel);
+         if (TraceCode) emitComment("while : test expression start");
+         op = genCond(p1, TRUE, &reg);
+         if (ProfileGenerate) probeBranch(tree, TRUE);
+         emitJump(op, reg, bodyLabel, "while : true");
+         if (TraceCode) emitComment("while : test expression end");
          break;
       case ReturnK:
-         if(tree->child[0] != NULL)
-           genExp(tree->child[0]);
+         p1 = tree->child[0];
+         if (p1 != NULL && p1->nodekind == ExpK && p1->kind.exp == CallK
+             && passEnabled("tail-calls") && !passesLocalArray(p1))
+         { genTailCall(p1);
+           break;
+         }
+         if(p1 != NULL)
+           genExp(p1);
+         emitReturn(numberOfParameters);
          break;
       default:
          break;
     }
 } /* genStmt */
 
-/* Procedure genExp generates code at an expression node */
+/* Function genCond generates code for the test
+ * of an if or while and returns the conditional
+ * jump taken when its truth is sense; the jump
+ * tests register reg. A comparison is not turned
+ * into 0 or 1 but branched on directly with the
+ * matching or inverse jump on the difference of
+ * its operands, unless compare-branch is off
+ */
+static TmOp genCond(TreeNode * tree, int sense, int * reg)
+{ TreeNode * p1, * p2;
+  int left, right, rel;
+  if (!passEnabled("compare-branch") || tree->kind.exp != OpK
+      || !isRelation(tree->attr.op))
+  { genExp(tree);
+    *reg = ac;
+    return sense ? opJNE : opJEQ;
+  }
+  rel = tree->attr.op;
+  p1 = tree->child[0];
+  p2 = tree->child[1];
+  if (p1->kind.exp == ConstK && p1->attr.val == 0)
+  { /* 0 < x is x > 0 */
+    p1 = p2;
+    p2 = tree->child[0];
+    rel = rel == LT ? GT : rel == LE ? GE : rel == GT ? LT : rel == GE ? LE : rel;
+  }
+  if (TraceCode) emitComment("-> condition") ;
+  if (p2->kind.exp == ConstK && p2->attr.val == 0)
+    /* comparing with zero needs no subtraction */
+    *reg = genSource(p1, ac, tempRegs);
+  else
+  { genOperands(p1, p2, ac, tempRegs, &left, &right);
+    emitRO(opSUB,ac,left,right,"condition: compare") ;
+    *reg = ac;
+  }
+  if (TraceCode) emitComment("<- condition") ;
+  if (sense)
+    switch (rel)
+    { case LT: return opJLT;
+      case LE: return opJLE;
+      case GT: return opJGT;
+      case GE: return opJGE;
+      case EQ: return opJEQ;
+      default: return opJNE;
+    }
+  switch (rel)
+  { case LT: return opJGE;
+    case LE: return opJGT;
+    case GT: return opJLE;
+    case GE: return opJLT;
+    case EQ: return opJNE;
+    default: return opJEQ;
+  }
+}
+
+/* Function log2Const returns k if tree is the
+ * constant 2^k, and -1 otherwise
+ */
+static int log2Const(TreeNode * tree)
+{ int k = 0;
+  if (tree->nodekind != ExpK || tree->kind.exp != ConstK
+      || tree->attr.val <= 0)
+    return -1;
+  while ((1 << k) < tree->attr.val && k < 30)
+    k++;
+  return (1 << k) == tree->attr.val ? k : -1;
+}
+
+/* Function hasAssign returns TRUE if the
+ * expression contains an assignment
+ */
+static int hasAssign(TreeNode * tree)
+{ int i;
+  if (tree == NULL)
+    return FALSE;
+  if (tree->nodekind == ExpK && tree->kind.exp == AssignK)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    if (hasAssign(tree->child[i]))
+      return TRUE;
+  if (tree->nodekind == ExpK && tree->kind.exp == CallK)
+    for (tree = tree->child[0]; tree != NULL; tree = tree->sibling)
+      if (hasAssign(tree))
+        return TRUE;
+  return FALSE;
+}
+
+/* Function readsShared returns TRUE if the
+ * expression reads a value a call may change:
+ * a global variable, an array element, or a
+ * register variable not saved across the call
+ */
+static int readsShared(TreeNode * tree)
+{ int i;
+  if (tree == NULL)
+    return FALSE;
+  if (tree->kind.exp == IdArrayK || idRegister(tree) >= 0)
+    return TRUE;
+  if (tree->kind.exp == IdK && tree->sym->storage == GlobalS)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    if (readsShared(tree->child[i]))
+      return TRUE;
+  return FALSE;
+}
+
+/* Function canSwap returns TRUE if the right
+ * operand p2 may be evaluated before the left
+ * operand p1 without changing the result
+ */
+static int canSwap(TreeNode * p1, TreeNode * p2)
+{ if (hasCall(p1) || hasAssign(p1) || hasAssign(p2))
+    return FALSE;
+  return !hasCall(p2) || !readsShared(p1);
+}
+
+/* Function regNeed returns the Sethi-Ullman number
+ * of an expression: the registers needed to
+ * evaluate it without spilling
+ */
+static int regNeed(TreeNode * tree)
+{ int n1, n2;
+  TreeNode * p1, * p2;
+  if (tree == NULL)
+    return 0;
+  switch (tree->kind.exp)
+  { case CallK:
+      return CALLNEED;
+    case IdK:
+      return idRegister(tree) >= 0 ? 0 : 1;
+    case IdArrayK:
+      if (tree->child[0] == NULL)
+        return 1;
+      n1 = regNeed(tree->child[0]);
+      if (n1 < 1)
+        n1 = 1;
+      if (tree->sym->storage == ParamS && n1 < 2)
+        return 2; /* index and array pointer */
+      return n1;
+    case AssignK:
+      n1 = regNeed(tree->child[1]);
+      if (n1 < 1)
+        n1 = 1;
+      if (tree->child[0]->kind.exp == IdArrayK)
+      { n2 = regNeed(tree->child[0]) + 1;
+        return n1 > n2 ? n1 : n2;
+      }
+      return n1;
+    case OpK:
+      p1 = tree->child[0];
+      p2 = tree->child[1];
+      if (isModulo(tree, &p1, &p2))
+        ;
+      else if ((tree->attr.op == TIMES || tree->attr.op == OVER)
+               && log2Const(p2) > 0)
+        return regNeed(p1);
+      else if (tree->attr.op == TIMES && log2Const(p1) > 0)
+        return regNeed(p2);
+      else if ((tree->attr.op == PLUS || tree->attr.op == MINUS)
+               && p2->kind.exp == ConstK)
+        return regNeed(p1);
+      n1 = regNeed(p1);
+      n2 = regNeed(p2);
+      if (p1->kind.exp == ConstK || p2->kind.exp == ConstK)
+      { n1 = n1 > n2 ? n1 : n2;
+        return n1 > 2 ? n1 : 2;
+      }
+      if (n1 == n2)
+        return n1 + 1;
+      return n1 > n2 ? n1 : n2;
+    default:
+      return 1;
+  }
+}
+
+/* Function countRegs returns the number of
+ * registers in the register set regs
+ */
+static int countRegs(int regs)
+{ int n = 0;
+  while (regs != 0)
+  { n += regs & 1;
+    regs >>= 1;
+  }
+  return n;
+}
+
+/* Function pickReg returns a register of the
+ * set regs, or -1 if it is empty
+ */
+static int pickReg(int regs)
+{ int r;
+  for (r = 0; r < pc; r++)
+    if (regs & (1 << r))
+      return r;
+  return -1;
+}
+
+/* Function idRegister returns the register that
+ * holds the variable tree refers to, or -1 if
+ * tree is not such a variable
+ */
+static int idRegister(TreeNode * tree)
+{ if (tree == NULL || tree->nodekind != ExpK || tree->kind.exp != IdK)
+    return -1;
+  return varRegister(tree->sym);
+}
+
+/* Function readsReg returns TRUE if the
+ * expression reads a variable held in register r
+ */
+static int readsReg(TreeNode * tree, int r)
+{ int i;
+  if (tree == NULL)
+    return FALSE;
+  if (idRegister(tree) == r)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    if (readsReg(tree->child[i], r))
+      return TRUE;
+  if (tree->kind.exp == CallK)
+    for (tree = tree->child[0]; tree != NULL; tree = tree->sibling)
+      if (readsReg(tree, r))
+        return TRUE;
+  return FALSE;
+}
+
+/* Function genSource returns the register holding
+ * the value of tree: the variable's own register,
+ * or t after generating code for it
+ */
+static int genSource(TreeNode * tree, int t, int avail)
+{ int r = idRegister(tree);
+  if (r >= 0)
+    return r;
+  genExpTo(tree, t, avail);
+  return t;
+}
+
+/* Procedure genOperands generates code for the
+ * operands of a binary operator into registers
+ * taken from avail, one of them being t, and
+ * returns them in left and right.
+ * The operand needing more registers goes first
+ * when the order cannot be observed; the first
+ * value is spilled only when too few registers
+ * are left or the second operand makes a call
+ */
+static void genOperands(TreeNode * p1, TreeNode * p2, int t, int avail,
+                        int * left, int * right)
+{ TreeNode * first, * second;
+  int u, r1, r2, swap;
+  int others = avail & ~(1 << t);
+  if (p2->kind.exp == ConstK || p1->kind.exp == ConstK)
+  { first = p2->kind.exp == ConstK ? p1 : p2;
+    second = p2->kind.exp == ConstK ? p2 : p1;
+    r1 = genSource(first, t, avail);
+    r2 = r1 == t ? pickReg(others) : t;
+    emitRM(opLDC,r2,second->attr.val,0,"load const operand");
+    *left = first == p1 ? r1 : r2;
+    *right = first == p1 ? r2 : r1;
+    return;
+  }
+  r1 = idRegister(p1);
+  r2 = idRegister(p2);
+  if (r1 >= 0 && r2 >= 0)
+  { *left = r1;
+    *right = r2;
+    return;
+  }
+  /* a register variable is used in place unless
+     the other operand may change it first */
+  if ((r1 >= 0 && !hasCall(p2) && !hasAssign(p2))
+      || r2 >= 0)
+  { first = r1 >= 0 ? p2 : p1;
+    u = r1 == t || r2 == t ? pickReg(others) : t;
+    genExpTo(first, u, u == t ? avail : others);
+    *left = r1 >= 0 ? r1 : u;
+    *right = r1 >= 0 ? u : r2;
+    return;
+  }
+  swap = regNeed(p2) > regNeed(p1) && canSwap(p1, p2);
+  first = swap ? p2 : p1;
+  second = swap ? p1 : p2;
+  if (TraceCode) emitComment(swap ? "-> right" : "-> left") ;
+  genExpTo(first, t, avail);
+  if (TraceCode) emitComment(swap ? "<- right" : "<- left") ;
+  /* a variable in memory is loaded into the one
+     register left; anything else may need two */
+  if ((countRegs(others) >= 2
+       || (countRegs(others) == 1 && second->kind.exp == IdK))
+      && !hasCall(second))
+  { u = pickReg(others);
+    if (TraceCode) emitComment(swap ? "-> left" : "-> right") ;
+    genExpTo(second, u, others);
+    if (TraceCode) emitComment(swap ? "<- left" : "<- right") ;
+    r1 = t;
+    r2 = u;
+  }
+  else
+  { emitRM(opST,t,--tmpOffset,mp,"op: spill operand");
+    if (TraceCode) emitComment(swap ? "-> left" : "-> right") ;
+    genExpTo(second, t, avail);
+    if (TraceCode) emitComment(swap ? "<- left" : "<- right") ;
+    u = pickReg(others);
+    emitRM(opLD,u,tmpOffset++,mp,"op: reload operand");
+    r1 = u;
+    r2 = t;
+  }
+  *left = swap ? r2 : r1;
+  *right = swap ? r1 : r2;
+}
+
+/* Function genAddress generates code leaving the
+ * address of an indexed array element in register
+ * base, less the returned displacement, so the
+ * element is at displacement(base). base is t
+ * unless the index is a register variable
+ */
+static int genAddress(TreeNode * tree, int t, int avail, int * base)
+{ int u, r, k = 0;
+  TreeNode * index = tree->child[0];
+  /* a constant added to the index goes into the
+     displacement */
+  if (index->kind.exp == OpK
+      && (index->attr.op == PLUS || index->attr.op == MINUS)
+      && index->child[1]->kind.exp == ConstK)
+  { k = index->attr.op == PLUS ? index->child[1]->attr.val
+                               : -index->child[1]->attr.val;
+    index = index->child[0];
+  }
+  r = genSource(index, t, avail);
+  *base = t;
+  switch (tree->sym->storage)
+  { case LocalS:
+      emitRO(opADD, t, r, fp, "index + local base");
+      return tree->sym->offset + k;
+    case ParamS:
+      u = pickReg(avail & ~(1 << t));
+      genVar(opLD, u, tree->sym, "load array parameter address");
+      emitRO(opADD, t, r, u, "index + array address");
+      return k;
+    default:
+      /* gp is the bottom of memory, so the global
+         offset is the element displacement */
+      *base = r;
+      return tree->sym->offset + k;
+  }
+}
+
+/* Procedure genExp generates code at an expression
+ * node leaving the value in ac
+ */
 void genExp( TreeNode * tree)
-{ int loc, depth, arrayIndex;
+{ genExpTo(tree, ac, tempRegs);
+}
+
+/* Procedure genExpTo generates code at an
+ * expression node leaving the value in register t.
+ * avail holds t and the other registers it may use
+ */
+static void genExpTo( TreeNode * tree, int t, int avail)
+{ int loc, savedOffset, u, saved;
+  Symbol * savedSyms[NVARREGS];
+  int left, right;
   TreeNode * p1, * p2;
   char comment[128];
   if(tree == NULL)
@@ -170,56 +639,38 @@ void genExp( TreeNode * tree)
   switch (tree->kind.exp) {
 
     case ConstK :
-      sprintf(comment, "-> const %d", tree->attr.val);
-      if (TraceCode) emitComment(comment) ;
+      if (TraceCode)
+      { sprintf(comment, "-> const %d", tree->attr.val);
+        emitComment(comment);
+      }
       /* gen code to load integer constant using LDC */
-      emitRM("LDC",ac,tree->attr.val,0,"load const");
+      emitRM(opLDC,t,tree->attr.val,0,"load const");
       if (TraceCode)  emitComment("<- Const end") ;
       break; /* ConstK */
     
     case IdArrayK :
       if (TraceCode) emitComment("-> array") ;
-      emitRM("LDC", ac1, 0, 0, "");
-      loc = getLocalNameOffset(tree->attr.name);
-      if(loc == -1)
-      {
-        loc = getParameterOffset(tree->attr.name);
-        if(loc == -1)
-        {
-          loc = st_get_location("~", tree->attr.name);
-          emitRM("LDA", ac, loc, gp, "id : load address to ac");
-        }
-        else
-          emitRM("LD", ac, loc + 1, fp, "id : load address to ac");
-      }
-      else
-        emitRM("LDA", ac, loc, mp, "id : load address to ac");
       if(tree->child[0] != NULL)
       {
-        emitRM("ST",ac,--tmpOffset,mp,"op: push ac"); 
-        genExp(tree->child[0]);
-        emitRM("LDA", ac1, 0, ac, "save index to ac1");
-        emitRM("LD",ac,tmpOffset++,mp, "op: load ac");
-        emitRO("ADD", ac1, ac1, ac, "get location");
-        emitRM("LD", ac, 0, ac1, "get value");
+        loc = genAddress(tree, t, avail, &u);
+        emitRM(opLD, t, loc, u, "get value");
+        break;
       }
+      /* an array parameter holds the address */
+      genVar(tree->sym->storage == ParamS ? opLD : opLDA, t, tree->sym,
+             "id : load address");
       break;
     case IdK :
       if (TraceCode) emitComment("-> Id") ;
-      loc = getLocalNameOffset(tree->attr.name);
-      if (loc == -1) //parameter, global
+      u = idRegister(tree);
+      if (u >= 0)
       {
-        loc = getParameterOffset(tree->attr.name);
-        if (loc == -1)
-        {
-          loc = st_get_location("~", tree->attr.name);
-          emitRM("LD", ac, loc, gp, "id: load value to ac");
-        }
-        else
-          emitRM("LD", ac, loc + 1, fp, "id: load value to ac");
+        if (u != t)
+          emitRM(opLDA, t, 0, u, "id: copy register");
+        if (TraceCode)  emitComment("<- Id") ;
+        break;
       }
-      else
-        emitRM("LD", ac, loc, mp, "id: load value to ac");
+      genVar(opLD, t, tree->sym, "id: load value");
       if (TraceCode)  emitComment("<- Id") ;
       break; /* IdK */
 
@@ -227,72 +678,104 @@ void genExp( TreeNode * tree)
          if (TraceCode) emitComment("-> Op") ;
          p1 = tree->child[0];
          p2 = tree->child[1];
-         /* gen code for ac = left arg */
-         if (TraceCode) emitComment("-> left") ;
-         genExp(p1);
-         if (TraceCode) emitComment("<- left") ;
-         /* gen code to push left operand */
-         emitRM("ST",ac,--tmpOffset,mp,"op: push left");
-         /* gen code for ac = right operand */
-         if (TraceCode) emitComment("-> right") ;
-         genExp(p2);
-         if (TraceCode) emitComment("<- right") ;
-         /* now load left operand */
-         emitRM("LD",ac1,tmpOffset++,mp,"op: load left");
+         if (isModulo(tree, &p1, &p2))
+         { /* a-a/b*b is a single MOD */
+           genOperands(p1, p2, t, avail, &left, &right);
+           emitRO(opMOD,t,left,right,"op %");
+           if (TraceCode)  emitComment("<- Op") ;
+           break;
+         }
+         if (tree->attr.op == TIMES
+             && (log2Const(p1) > 0 || log2Const(p2) > 0))
+         { /* multiply by a power of two is a shift */
+           if (log2Const(p2) > 0)
+           { u = genSource(p1, t, avail);
+             emitRM(opSHL,t,log2Const(p2),u,"op * by shift");
+           }
+           else
+           { u = genSource(p2, t, avail);
+             emitRM(opSHL,t,log2Const(p1),u,"op * by shift");
+           }
+           if (TraceCode)  emitComment("<- Op") ;
+           break;
+         }
+         if (tree->attr.op == OVER && log2Const(p2) > 0)
+         { /* divide by a power of two is a shift, with
+              2^k-1 added first to a negative dividend
+              so that the quotient is truncated to zero */
+           u = genSource(p1, t, avail);
+           if (u != t)
+             emitRM(opLDA,t,0,u,"op / by shift: copy dividend");
+           emitRM(opJGE,t,1,pc,"skip rounding if not negative");
+           emitRM(opLDA,t,(1 << log2Const(p2)) - 1,t,"round to zero");
+           emitRM(opSHR,t,log2Const(p2),t,"op / by shift");
+           if (TraceCode)  emitComment("<- Op") ;
+           break;
+         }
+         if ((tree->attr.op == PLUS || tree->attr.op == MINUS)
+             && p2->kind.exp == ConstK)
+         { /* add or subtract a constant with LDA */
+           u = genSource(p1, t, avail);
+           emitRM(opLDA,t,tree->attr.op == PLUS ? p2->attr.val : -p2->attr.val,
+                  u,"op +/- const");
+           if (TraceCode)  emitComment("<- Op") ;
+           break;
+         }
+         genOperands(p1, p2, t, avail, &left, &right);
          switch (tree->attr.op) {
             case PLUS :
-               emitRO("ADD",ac,ac1,ac,"op +");
+               emitRO(opADD,t,left,right,"op +");
                break;
             case MINUS :
-               emitRO("SUB",ac,ac1,ac,"op -");
+               emitRO(opSUB,t,left,right,"op -");
                break;
             case TIMES :
-               emitRO("MUL",ac,ac1,ac,"op *");
+               emitRO(opMUL,t,left,right,"op *");
                break;
             case OVER :
-               emitRO("DIV",ac,ac1,ac,"op /");
+               emitRO(opDIV,t,left,right,"op /");
                break;
             case LT :
-               emitRO("SUB",ac,ac1,ac,"op <") ;
-               emitRM("JLT",ac,2,pc,"br if true") ;
-               emitRM("LDC",ac,0,ac,"false case") ;
-               emitRM("LDA",pc,1,pc,"unconditional jmp") ;
-               emitRM("LDC",ac,1,ac,"true case") ;
+               emitRO(opSUB,t,left,right,"op <") ;
+               emitRM(opJLT,t,2,pc,"br if true") ;
+               emitRM(opLDC,t,0,t,"false case") ;
+               emitRM(opLDA,pc,1,pc,"unconditional jmp") ;
+               emitRM(opLDC,t,1,t,"true case") ;
                break;
             case LE :
-               emitRO("SUB",ac,ac1,ac,"op <=") ;
-               emitRM("JLE",ac,2,pc,"br if true") ;
-               emitRM("LDC",ac,0,ac,"false case") ;
-               emitRM("LDA",pc,1,pc,"unconditional jmp") ;
-               emitRM("LDC",ac,1,ac,"true case") ;
+               emitRO(opSUB,t,left,right,"op <=") ;
+               emitRM(opJLE,t,2,pc,"br if true") ;
+               emitRM(opLDC,t,0,t,"false case") ;
+               emitRM(opLDA,pc,1,pc,"unconditional jmp") ;
+               emitRM(opLDC,t,1,t,"true case") ;
                break;
             case GT :
-               emitRO("SUB",ac,ac1,ac,"op >") ;
-               emitRM("JGT",ac,2,pc,"br if true") ;
-               emitRM("LDC",ac,0,ac,"false case") ;
-               emitRM("LDA",pc,1,pc,"unconditional jmp") ;
-               emitRM("LDC",ac,1,ac,"true case") ;
+               emitRO(opSUB,t,left,right,"op >") ;
+               emitRM(opJGT,t,2,pc,"br if true") ;
+               emitRM(opLDC,t,0,t,"false case") ;
+               emitRM(opLDA,pc,1,pc,"unconditional jmp") ;
+               emitRM(opLDC,t,1,t,"true case") ;
                break;
             case GE :
-               emitRO("SUB",ac,ac1,ac,"op >=") ;
-               emitRM("JGE",ac,2,pc,"br if true") ;
-               emitRM("LDC",ac,0,ac,"false case") ;
-               emitRM("LDA",pc,1,pc,"unconditional jmp") ;
-               emitRM("LDC",ac,1,ac,"true case") ;
+               emitRO(opSUB,t,left,right,"op >=") ;
+               emitRM(opJGE,t,2,pc,"br if true") ;
+               emitRM(opLDC,t,0,t,"false case") ;
+               emitRM(opLDA,pc,1,pc,"unconditional jmp") ;
+               emitRM(opLDC,t,1,t,"true case") ;
                break;
             case EQ :
-               emitRO("SUB",ac,ac1,ac,"op ==") ;
-               emitRM("JEQ",ac,2,pc,"br if true");
-               emitRM("LDC",ac,0,ac,"false case") ;
-               emitRM("LDA",pc,1,pc,"unconditional jmp") ;
-               emitRM("LDC",ac,1,ac,"true case") ;
+               emitRO(opSUB,t,left,right,"op ==") ;
+               emitRM(opJEQ,t,2,pc,"br if true");
+               emitRM(opLDC,t,0,t,"false case") ;
+               emitRM(opLDA,pc,1,pc,"unconditional jmp") ;
+               emitRM(opLDC,t,1,t,"true case") ;
                break;
             case NE :
-               emitRO("SUB",ac,ac1,ac,"op !=") ;
-               emitRM("JNE",ac,2,pc,"br if true");
-               emitRM("LDC",ac,0,ac,"false case") ;
-               emitRM("LDA",pc,1,pc,"unconditional jmp") ;
-               emitRM("LDC",ac,1,ac,"true case") ;
+               emitRO(opSUB,t,left,right,"op !=") ;
+               emitRM(opJNE,t,2,pc,"br if true");
+               emitRM(opLDC,t,0,t,"false case") ;
+               emitRM(opLDA,pc,1,pc,"unconditional jmp") ;
+               emitRM(opLDC,t,1,t,"true case") ;
                break;
             default:
                emitComment("BUG: Unknown operator");
@@ -305,92 +788,44 @@ void genExp( TreeNode * tree)
     case VarArrayK:
       break;
     case CallK:
-      sprintf(comment, "-> call function %s", tree->attr.name);
-      if(TraceCode) emitComment(comment);
+      if (TraceCode)
+      { sprintf(comment, "-> call function %s", tree->attr.name);
+        emitComment(comment);
+      }
       p1 = tree->child[0];
+      savedOffset = tmpOffset;
       numberOfArguments = pushArguments(0, p1);
-      emitRM("LDA", mp, -numberOfArguments, mp, "stack growth after push arguments");
-      tmpOffset = 0;
-      sprintf(comment, "%d arguments are pushed", numberOfArguments);
-      if(TraceCode) emitComment(comment);
-      emitRM("LDC", ac1, 1, 0, "ac1 = 1");
-      emitRO("SUB", mp, mp, ac1, "mp = mp - ac1");
-      emitRM("ST", fp, 0, mp, "push fp");
-      emitRM("LDA", fp, 0, mp, "copy sp to fp");
-      emitRO("SUB", mp, mp, ac1, "mp = mp - ac1");
-      emitRM("LDC", ac1, 2, 0, "ac1 = 2");
-      emitRO("ADD", ac1, ac1, pc, "calculate return address");
-      emitRM("ST", ac1, 0, mp, "push return address");
-      loc = st_get_location("~", tree->attr.name);
-      if (TraceCode) sprintf(comment, "jump to function at %d", loc);
-      emitRM("LD", pc, loc, gp, comment);
-      if (numberOfArguments > 0)
-      {
-         emitRM("LDC", ac1, numberOfArguments, 0, "ac1 = numberOfArguments");
-         emitRO("ADD", mp, mp, ac1, "pop arguments");
+      if (TraceCode)
+      { sprintf(comment, "%d arguments are pushed", numberOfArguments);
+        emitComment(comment);
+      }
+      /* register variables needed after the call
+         go to their home slots while it runs */
+      saved = liveAcrossCall(tree, savedSyms);
+      for (u = 0; u < saved; u++)
+        genVar(opST, varRegister(savedSyms[u]), savedSyms[u],
+               "save register variable");
+      if (tmpOffset != 0)
+        emitRM(opLDA, mp, tmpOffset, mp, "stack growth after push arguments");
+      if (ProfileGenerate) probeCall(tree->lineno, tree->attr.name);
+      emitJump(opCALL, mp, functionLabel[tree->sym->offset],
+               "push return address and jump");
+      /* the callee popped the arguments, drop the temporaries */
+      if (savedOffset != 0)
+        emitRM(opLDA, mp, -savedOffset, mp, "pop temporaries");
+      tmpOffset = savedOffset;
+      for (u = 0; u < saved; u++)
+        genVar(opLD, varRegister(savedSyms[u]), savedSyms[u],
+               "restore register variable");
+      if (t != ac)
+        emitRM(opLDA, t, 0, ac, "move return value");
+      if (TraceCode)
+      { sprintf(comment, "<- call function %s end", tree->attr.name);
+        emitComment(comment);
       }
-      sprintf(comment, "<- call function %s end", tree->attr.name);
       break;
     case AssignK:
-      sprintf(comment, "-> assign to %s", tree->child[0]->attr.name);
-      if (TraceCode) emitComment(comment) ;
-      /* generate code for rhs */
-      if (TraceCode) emitComment("-> generate code for rhs") ;
-      genExp(tree->child[1]);
-      if (TraceCode) emitComment("<- generate code for rhs end") ;
-      /* now store value */
-      if (TraceCode) emitComment("-> store value start") ;
-      if (tree->child[0]->kind.exp == IdArrayK)
-      {
-        if (TraceCode) emitComment("-> array") ;
-        emitRM("ST",ac,--tmpOffset,mp,"op: push ac");        
-        genExp(tree->child[0]->child[0]);
-        emitRM("LDA", ac1, 0, ac, "save index to ac1");
-        loc = getLocalNameOffset(tree->child[0]->attr.name);
-        if (loc == -1)
-        {
-          loc = getParameterOffset(tree->child[0]->attr.name);
-          if (loc == -1)
-          {
-            loc = st_get_location("~", tree->child[0]->attr.name);
-            emitRM("LDA", ac, loc, gp, "load address");
-            emitRO("ADD", ac1, ac, ac1, "ac1 = address + index");
-          }
-          else
-          {
-            emitRM("LD", ac, loc + 1, fp, "load address");
-            emitRO("ADD", ac1, ac, ac1, "ac1 = address + index");
-          }
-        }
-        else
-        {
-          emitRM("LDA", ac, loc, mp, "load address");
-          emitRO("ADD", ac1, ac, ac1, "ac1 = address + index");
-        }
-        emitRM("LD",ac,tmpOffset++,mp,"op: load ac");
-        emitRM("ST", ac, 0, ac1, "store");
-        if (TraceCode) emitComment("<- store value end") ;
-        if (TraceCode)  emitComment("<- assign") ;
-        break;
-      }
-      loc = getLocalNameOffset(tree->child[0]->attr.name);
-      if (loc == -1) //parameter, global
-      {
-        loc = getParameterOffset(tree->child[0]->attr.name);
-        if (loc == -1)
-        {
-          loc = st_get_location("~", tree->child[0]->attr.name);
-          emitRM("ST", ac, loc, gp, "assign: store value");
-        }
-        else
-          emitRM("ST", ac, loc + 1, fp, "assign: store value");
-        }
-      }
-      else
-        emitRM("ST", ac, loc, mp, "assign: store value");
-      }
-      if (TraceCode) emitComment("<- store value end") ;
-      if (TraceCode)  emitComment("<- assign") ;
+      genAssign(tree, t, avail, TRUE);
       break; /* assign_k */
     case SingleParamK:
       break;
@@ -399,7 +834,93 @@ void genExp( TreeNode * tree)
     default:
       break;
   }
-} /* genExp */
+} /* genExpTo */
+
+/* Procedure genAssign generates code for an
+ * assignment, leaving the value in register t
+ * if needed is TRUE. A register variable gets
+ * its value computed in place when that cannot
+ * overwrite an operand still to be read
+ */
+static void genAssign( TreeNode * tree, int t, int avail, int needed)
+{ int loc, u, r, v;
+  TreeNode * lhs = tree->child[0];
+  TreeNode * rhs = tree->child[1];
+  TreeNode * a, * b;
+  char comment[128];
+  if (TraceCode)
+  { sprintf(comment, "-> assign to %s", lhs->attr.name);
+    emitComment(comment);
+  }
+  r = idRegister(lhs);
+  if (r >= 0)
+  {
+    /* i = i + 1 and the like read r only as an
+       operand that is used in place */
+    if (!hasAssign(rhs)
+        && (!readsReg(rhs, r)
+            || (rhs->kind.exp == OpK && !isModulo(rhs, &a, &b)
+                && ((idRegister(rhs->child[0]) == r
+                     && !readsReg(rhs->child[1], r)
+                     && !hasCall(rhs->child[1]))
+                    || (idRegister(rhs->child[1]) == r
+                        && !readsReg(rhs->child[0], r))))))
+    {
+      if (TraceCode) emitComment("-> generate code for rhs in place") ;
+      genExpTo(rhs, r, avail | (1 << r));
+      if (TraceCode) emitComment("<- generate code for rhs end") ;
+      if (needed)
+        emitRM(opLDA, t, 0, r, "assign: copy value");
+    }
+    else
+    {
+      if (TraceCode) emitComment("-> generate code for rhs") ;
+      genExpTo(rhs, t, avail);
+      if (TraceCode) emitComment("<- generate code for rhs end") ;
+      emitRM(opLDA, r, 0, t, "assign: move to register");
+    }
+    if (TraceCode)  emitComment("<- assign") ;
+    return;
+  }
+  /* generate code for rhs */
+  if (TraceCode) emitComment("-> generate code for rhs") ;
+  if (lhs->kind.exp == IdArrayK && !needed
+      && !hasCall(lhs->child[0]) && !hasAssign(lhs->child[0]))
+    v = genSource(rhs, t, avail);
+  else
+  {
+    genExpTo(rhs, t, avail);
+    v = t;
+  }
+  if (TraceCode) emitComment("<- generate code for rhs end") ;
+  /* now store value */
+  if (TraceCode) emitComment("-> store value start") ;
+  if (lhs->kind.exp == IdArrayK)
+  {
+    if (TraceCode) emitComment("-> array") ;
+    if (v != t)
+      loc = genAddress(lhs, t, avail, &u);
+    else if (countRegs(avail & ~(1 << t)) >= regNeed(lhs) && !hasCall(lhs))
+    {
+      u = pickReg(avail & ~(1 << t));
+      loc = genAddress(lhs, u, avail & ~(1 << t), &u);
+    }
+    else
+    {
+      emitRM(opST,t,--tmpOffset,mp,"op: spill value");
+      u = pickReg(avail & ~(1 << t));
+      loc = genAddress(lhs, u, avail, &u);
+      emitRM(opLD,t,tmpOffset++,mp,"op: reload value");
+    }
+    emitRM(opST, v, loc, u, "store");
+    if (TraceCode) emitComment("<- store value end") ;
+    if (TraceCode)  emitComment("<- assign") ;
+    return;
+  }
+  genVar(opST, t, lhs->sym, "assign: store value");
+  if (TraceCode) emitComment("<- store value end") ;
+  if (TraceCode)  emitComment("<- assign") ;
+} /* genAssign */
 
 /* Procedure cGen recursively generates code by
  * tree traversal
@@ -411,7 +932,10 @@ static void cGen( TreeNode * tree)
         genStmt(tree);
         break;
       case ExpK:
-        genExp(tree);
+        if (tree->kind.exp == AssignK)
+          genAssign(tree, ac, tempRegs, FALSE);
+        else
+          genExp(tree);
         break;
       default:
         break;
@@ -445,99 +969,127 @@ int getSizeOfGlobal(TreeNode * syntaxTree)
  * file name as a comment in the code file
  */
 void codeGen(TreeNode * syntaxTree, char * codefile)
-{  char * s = malloc(strlen(codefile)+7);
-   strcpy(s,"File: ");
-   strcat(s,codefile);
-   emitComment("TINY Compilation to TM Code");
-   emitComment(s);
-   /* generate standard prelude */
-   emitComment("Standard prelude:");
-   emitRM("LD",mp,0,ac,"load maxaddress from location 0");
-   emitRM("ST",ac,0,ac,"clear location 0");
-   emitComment("End of standard prelude.");
+{  TreeNode * t;
+   /* give every function a label for direct calls */
+   functionLabel = (int *) malloc(sizeof(int) * (getSizeOfGlobal(syntaxTree) + 1));
+   for (t = syntaxTree; t != NULL; t = t->sibling)
+     if (t->nodekind == StmtK && t->kind.stmt == FunctionK)
+       functionLabel[t->sym->offset] = newLabel();
+   emitPrelude(codefile, functionLabel[st_lookup("~", "main")->sym->offset]);
    /* generate code for TINY program */
-   forFunctionTable = emitSkip(getSizeOfGlobal(syntaxTree)*2 + 1);
    cGen(syntaxTree);
-   /* jump to main */
-   int memloc = st_get_location("~", "main");
-   emitBackup(forFunctionTable);
-   emitRM("LDC", pc, locMain, 0, "jump to main");
-   emitRestore();
-   /* finish */
-   emitComment("End of execution.");
-   emitRO("HALT",0,0,0,"done");
 }
 
 int pushArguments(int depth, TreeNode * tree)
 {
+   int r;
    if(tree == NULL)
     return depth;
    depth = pushArguments(depth + 1, tree->sibling);
-   genExp(tree);
+   r = idRegister(tree);
+   if (r < 0)
+   {
+     genExp(tree);
+     r = ac;
+   }
    //parameterStack[--parameterStackIndex] = tree->attr.name;
-   //emitRM("LDC", ac1, 1, 0, "ac1 = 1");
-   //emitRO("SUB", mp, mp, ac1, "mp = mp - ac1");
-   emitRM("ST", ac, --tmpOffset, mp, "op: push argument(reverse order)");
+   //emitRM(opLDC, ac1, 1, 0, "ac1 = 1");
+   //emitRO(opSUB, mp, mp, ac1, "mp = mp - ac1");
+   emitRM(opST, r, --tmpOffset, mp, "op: push argument(reverse order)");
    return depth;
 }
 
-int pushParameters(char *functionName)
-{
-   char* parameters[SIZE];
-   char tmp[128];
-   int max = 0;
-   sprintf(tmp, "~:%s", functionName);
-   ScopeList scope = getScope(tmp);
-   if(scope == NULL)
-     return;
-   int i;
-   for (i=0;i<SIZE;++i)
-   { if (scope->bucket[i] != NULL)
-     { BucketList l = scope->bucket[i];
-       while (l != NULL)
-       {
-         if(max < l->memloc)
-           max = l->memloc;
-         parameters[l->memloc] = l->name;
-         l = l->next;
-       }
-     }
-   }
-
-   for (i=max; i>=0;i--)
-     parameterStack[--parameterStackIndex] = parameters[i];
-
-   return max + 1;
+/* Function readsParamSlot returns TRUE if the
+ * expression reads a parameter from its frame
+ * slot rather than from a register
+ */
+static int readsParamSlot(TreeNode * tree)
+{ int i;
+  if (tree == NULL)
+    return FALSE;
+  if (tree->nodekind == ExpK
+      && (tree->kind.exp == IdK || tree->kind.exp == IdArrayK)
+      && tree->sym != NULL && tree->sym->storage == ParamS
+      && (tree->kind.exp == IdArrayK || varRegister(tree->sym) < 0))
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    if (readsParamSlot(tree->child[i]))
+      return TRUE;
+  return FALSE;
 }
 
-void insertFunction(int functionLocation, char *name)
-{
-   char comment[128];
-   int memloc = st_get_location("~", name);
-   emitBackup(forFunctionTable);
-   forFunctionTable += 2;
-   sprintf(comment, "function %s is at %d", name, memloc);
-   if (TraceCode) emitComment(comment);
-   sprintf(comment, "load function location(%d)", functionLocation);
-   emitRM("LDC", ac, functionLocation, 0, comment);
-   emitRM("ST", ac, memloc, gp, "add into memory");
-   emitRestore();
+/* Procedure genTailCall generates return f(args)
+ * as a jump that reuses the current frame, with
+ * the arguments placed as tailCallBase says
+ */
+static void genTailCall(TreeNode * tree)
+{ TreeNode * p;
+  int n = 0, i, base, direct = TRUE;
+  int r;
+  char comment[128];
+  if (TraceCode)
+  { sprintf(comment, "-> tail call function %s", tree->attr.name);
+    emitComment(comment);
+  }
+  for (p = tree->child[0]; p != NULL; p = p->sibling)
+  { n++;
+    if (hasCall(p) || hasAssign(p) || readsParamSlot(p))
+      direct = FALSE;
+  }
+  base = tailCallBase(numberOfParameters, n);
+  if (base < 1)
+    direct = FALSE;
+  if (direct)
+  { /* no argument looks at the parameter slots,
+       so each one is stored straight into place */
+    for (p = tree->child[0], i = 1; p != NULL; p = p->sibling, i++)
+    { r = genSource(p, ac, tempRegs);
+      emitRM(opST, r, base + i, fp, "tail call: store argument");
+    }
+  }
+  else
+  { /* evaluate into temporaries first */
+    pushArguments(0, tree->child[0]);
+    emitTailArguments(numberOfParameters, n, tmpOffset);
+    tmpOffset = 0;
+  }
+  emitTailFrame(numberOfParameters, n);
+  if (ProfileGenerate) probeCall(tree->lineno, tree->attr.name);
+  emitGoto(functionLabel[tree->sym->offset], "tail call: jump to function");
+  if (TraceCode)
+  { sprintf(comment, "<- tail call function %s end", tree->attr.name);
+    emitComment(comment);
+  }
 }
 
-int getLocalNameOffset(char *name)
+int countParameters(TreeNode * params)
 {
-   int i;
-   for(i = localNameStackIndex; i < 1024; i++)
-     if(localNameStack[i] != 0 && strcmp(localNameStack[i], name) == 0)
-       return i - localNameStackIndex;
-   return -1;
+   int count = 0;
+   while(params != NULL)
+   {
+     if(params->attr.name != NULL)
+       count++;
+     params = params->sibling;
+   }
+   return count;
 }
 
-int getParameterOffset(char *name)
+/* Procedure genVar emits op between register r
+ * and the memory word of the variable with
+ * symbol sym
+ */
+void genVar(TmOp op, int r, Symbol *sym, char *comment)
 {
-   int i;
-   for(i = parameterStackIndex; i< 1024; i++)
-     if(parameterStack[i] != 0 && strcmp(parameterStack[i], name) == 0)
-       return i - parameterStackIndex;
-   return -1;
-}
\ No newline at end of file
+   switch (sym->storage)
+   {
+     case GlobalS:
+       emitRM(op, r, sym->offset, gp, comment);
+       break;
+     case ParamS:
+       emitRM(op, r, sym->offset + PARAMOFFSET, fp, comment);
+       break;
+     default:
+       emitRM(op, r, sym->offset, fp, comment);
+       break;
+   }
+}
@@ -7,21 +7,130 @@
 /****************************************************/
 
 #include "globals.h"
+#include "util.h"
 #include "code.h"
+#include "optimize.h"
 
 /* TM location number for current instruction emission */
 static int emitLoc = 0 ;
 
-/* Highest TM location emitted so far
-   For use in conjunction with emitSkip,
-   emitBackup, and emitRestore */
-static int highEmitLoc = 0;
+/* the code buffer: the instruction at location
+   loc is buffer[loc] */
+static Instr * buffer = NULL;
+static int bufferMax = 0;
+
+/* the comment pool holds the comments of the
+   instructions, each ended by a null, only when
+   TraceCode is TRUE. The comment lines written
+   between two instructions are run together up
+   to the null ending them */
+static char * pool = NULL;
+static int poolSize = 0;
+static int poolMax = 0;
+
+/* where the comment lines waiting for the next
+   instruction start in the pool, or -1 */
+static int notes = -1;
+
+/* the probe waiting for the next instruction, or
+   NULL */
+static char * probe = NULL;
+
+/* opName holds the mnemonic of each TmOp */
+static char * opName[] =
+   { "HALT", "IN", "OUT", "ADD", "SUB", "MUL", "DIV", "MOD",
+     "LD", "ST", "LDA", "LDC", "JLT", "JLE", "JGT", "JGE",
+     "JEQ", "JNE", "SHL", "SHR", "CALL", "RET", "ENTER", "LEAVE"
+   };
+
+/* for each label: its location or -1, the label
+   it was threaded to or -1, and the last jump
+   waiting for it or -1. While a jump waits, its
+   d holds the jump waiting before it or -1, so
+   the chain is patched in place */
+static int * labelLoc = NULL;
+static int * labelAlias = NULL;
+static int * labelPatch = NULL;
+static int labelCount = 0;
+static int labelMax = 0;
+
+/* labels placed at emitLoc, held back until the
+   instruction there is known so that a jump to
+   a jump can be threaded */
+static int * hereLabel = NULL;
+static int hereCount = 0;
+
+/* TRUE after an unconditional jump or return,
+   when the next location is reached only
+   through a label */
+static int unreachable = FALSE;
+
+static void flushLabels(void);
+
+/* Procedure addText appends n characters of text
+ * to the comment pool
+ */
+static void addText(char * text, int n)
+{ if (poolSize + n > poolMax)
+  { while (poolSize + n > poolMax)
+      poolMax = poolMax == 0 ? 4096 : poolMax * 2;
+    pool = (char *) realloc(pool, poolMax);
+  }
+  memcpy(pool + poolSize, text, n);
+  poolSize += n;
+}
+
+/* Function newInstr adds instruction op at
+ * emitLoc to the code buffer and returns it
+ */
+static Instr * newInstr(TmOp op, int r, int d, int s, char * c)
+{ Instr * i;
+  if (emitLoc == bufferMax)
+  { bufferMax = bufferMax == 0 ? 256 : bufferMax * 2;
+    buffer = (Instr *) realloc(buffer, bufferMax * sizeof(Instr));
+  }
+  i = &buffer[emitLoc++];
+  i->op = op;
+  i->r = r;
+  i->d = d;
+  i->s = s;
+  i->t = 0;
+  i->target = -1;
+  i->kept = TRUE;
+  i->notes = notes;
+  i->c = -1;
+  i->probe = probe;
+  probe = NULL;
+  if (notes >= 0)
+    addText("", 1);
+  notes = -1;
+  if (TraceCode)
+  { i->c = poolSize;
+    addText(c, strlen(c) + 1);
+  }
+  return i;
+}
 
 /* Procedure emitComment prints a comment line 
  * with comment c in the code file
  */
 void emitComment( char * c )
-{ if (TraceCode) fprintf(code,"* %s\n",c);}
+{ if (TraceCode)
+  { if (notes < 0)
+      notes = poolSize;
+    addText("* ", 2);
+    addText(c, strlen(c));
+    addText("\n", 1);
+  }
+}
+
+/* Procedure emitProbe makes the next instruction
+ * carry probe p, written before it as a *@ line
+ * for tm to count it by
+ */
+void emitProbe( char * p )
+{ probe = copyString(p);
+}
 
 /* Procedure emitRO emits a register-only
  * TM instruction
@@ -31,11 +140,10 @@ void emitComment( char * c )
  * t = 2nd source register
  * c = a comment to be printed if TraceCode is TRUE
  */
-void emitRO( char *op, int r, int s, int t, char *c)
-{ fprintf(code,"%3d:  %5s  %d,%d,%d ",emitLoc++,op,r,s,t);
-  if (TraceCode) fprintf(code,"\t%s",c) ;
-  fprintf(code,"\n") ;
-  if (highEmitLoc < emitLoc) highEmitLoc = emitLoc ;
+void emitRO( TmOp op, int r, int s, int t, char *c)
+{ flushLabels();
+  unreachable = op == opHALT;
+  newInstr(op, r, 0, s, c)->t = t;
 } /* emitRO */
 
 /* Procedure emitRM emits a register-to-memory
@@ -46,39 +154,15 @@ void emitRO( char *op, int r, int s, int t, char *c)
  * s = the base register
  * c = a comment to be printed if TraceCode is TRUE
  */
-void emitRM( char * op, int r, int d, int s, char *c)
-{ fprintf(code,"%3d:  %5s  %d,%d(%d) ",emitLoc++,op,r,d,s);
-  if (TraceCode) fprintf(code,"\t%s",c) ;
-  fprintf(code,"\n") ;
-  if (highEmitLoc < emitLoc)  highEmitLoc = emitLoc ;
+void emitRM( TmOp op, int r, int d, int s, char *c)
+{ Instr * i;
+  flushLabels();
+  unreachable = op == opRET || (r == pc && (op == opLDA || op == opLDC));
+  i = newInstr(op, r, d, s, c);
+  if (s == pc)
+    i->target = emitLoc + d;
 } /* emitRM */
 
-/* Function emitSkip skips "howMany" code
- * locations for later backpatch. It also
- * returns the current code position
- */
-int emitSkip( int howMany)
-{  int i = emitLoc;
-   emitLoc += howMany ;
-   if (highEmitLoc < emitLoc)  highEmitLoc = emitLoc ;
-   return i;
-} /* emitSkip */
-
-/* Procedure emitBackup backs up to 
- * loc = a previously skipped location
- */
-void emitBackup( int loc)
-{ if (loc > highEmitLoc) emitComment("BUG in emitBackup");
-  emitLoc = loc ;
-} /* emitBackup */
-
-/* Procedure emitRestore restores the current 
- * code position to the highest previously
- * unemitted position
- */
-void emitRestore(void)
-{ emitLoc = highEmitLoc;}
-
 /* Procedure emitRM_Abs converts an absolute reference 
  * to a pc-relative reference when emitting a
  * register-to-memory TM instruction
@@ -87,11 +171,397 @@ void emitRestore(void)
  * a = the absolute location in memory
  * c = a comment to be printed if TraceCode is TRUE
  */
-void emitRM_Abs( char *op, int r, int a, char * c)
-{ fprintf(code,"%3d:  %5s  %d,%d(%d) ",
-               emitLoc,op,r,a-(emitLoc+1),pc);
-  ++emitLoc ;
-  if (TraceCode) fprintf(code,"\t%s",c) ;
-  fprintf(code,"\n") ;
-  if (highEmitLoc < emitLoc) highEmitLoc = emitLoc ;
+void emitRM_Abs( TmOp op, int r, int a, char * c)
+{ flushLabels();
+  unreachable = r == pc && op == opLDA;
+  newInstr(op, r, a - (emitLoc + 1), pc, c)->target = a;
 } /* emitRM_Abs */
+
+/* Function find returns the label that label
+ * was threaded to, following the chain
+ */
+static int find(int label)
+{ while (labelAlias[label] >= 0)
+    label = labelAlias[label];
+  return label;
+}
+
+/* Procedure patch points the jumps waiting for
+ * label l at location target
+ */
+static void patch(int l, int target)
+{ int loc;
+  while (labelPatch[l] >= 0)
+  { loc = labelPatch[l];
+    labelPatch[l] = buffer[loc].d;
+    buffer[loc].d = target - (loc + 1);
+    buffer[loc].target = target;
+  }
+}
+
+/* Procedure flushLabels gives the labels held
+ * at emitLoc their location and patches the
+ * jumps waiting for them
+ */
+static void flushLabels(void)
+{ int i, l;
+  for (i = 0; i < hereCount; i++)
+  { l = hereLabel[i];
+    labelLoc[l] = emitLoc;
+    patch(l, emitLoc);
+  }
+  if (hereCount > 0)
+    unreachable = FALSE;
+  hereCount = 0;
+}
+
+/* Function newLabel returns a new label for
+ * jumps whose target is not yet generated
+ */
+int newLabel(void)
+{ if (labelCount == labelMax)
+  { labelMax = labelMax == 0 ? 64 : labelMax * 2;
+    labelLoc = (int *) realloc(labelLoc, labelMax * sizeof(int));
+    labelAlias = (int *) realloc(labelAlias, labelMax * sizeof(int));
+    labelPatch = (int *) realloc(labelPatch, labelMax * sizeof(int));
+    hereLabel = (int *) realloc(hereLabel, labelMax * sizeof(int));
+  }
+  labelLoc[labelCount] = -1;
+  labelAlias[labelCount] = -1;
+  labelPatch[labelCount] = -1;
+  return labelCount++;
+}
+
+/* Procedure dropLast removes the instruction
+ * emitted last, keeping the comment lines before
+ * and after it
+ */
+static void dropLast(void)
+{ Instr * i = &buffer[--emitLoc];
+  char * after = NULL;
+  int n = 0;
+  if (!TraceCode)
+    return;
+  if (notes >= 0)
+  { n = poolSize - notes;
+    after = (char *) malloc(n);
+    memcpy(after, pool + notes, n);
+  }
+  if (i->notes >= 0)
+  { /* run the lines on, over the null ending them */
+    notes = i->notes;
+    poolSize = notes + strlen(pool + notes);
+  }
+  else
+  { notes = -1;
+    poolSize = i->c;
+  }
+  if (after != NULL)
+  { if (notes < 0)
+      notes = poolSize;
+    addText(after, n);
+    free(after);
+  }
+}
+
+/* Procedure placeLabel places label at the
+ * current location. A jump just emitted to
+ * this location is dropped if thread-jumps is on
+ */
+void placeLabel(int label)
+{ int * q;
+  int l = find(label);
+  while (passEnabled("thread-jumps"))
+  { for (q = &labelPatch[l]; *q >= 0; q = &buffer[*q].d)
+      if (*q == emitLoc - 1)
+        break;
+    /* a call to the next location still pushes */
+    if (*q < 0 || buffer[*q].op == opCALL)
+      break;
+    *q = buffer[*q].d;
+    dropLast();
+    unreachable = FALSE;
+  }
+  hereLabel[hereCount++] = l;
+}
+
+/* Procedure emitPatch emits a jump to label l,
+ * at once if l is placed, else when it is
+ */
+static void emitPatch(TmOp op, int r, int l, char * c)
+{ flushLabels();
+  if (labelLoc[l] >= 0)
+  { emitRM_Abs(op, r, labelLoc[l], c);
+    return;
+  }
+  newInstr(op, r, labelPatch[l], pc, c);
+  labelPatch[l] = emitLoc - 1;
+}
+
+/* Procedure emitJump emits the conditional jump
+ * op on register r to label
+ */
+void emitJump( TmOp op, int r, int label, char * c)
+{ emitPatch(op, r, find(label), c);
+  unreachable = FALSE;
+}
+
+/* Procedure emitGoto emits an unconditional jump
+ * to label. If thread-jumps is on, labels placed
+ * here are threaded to label instead, and the
+ * jump is left out when nothing else reaches it
+ */
+void emitGoto( int label, char * c)
+{ int i, l, loc, n = 0, t = find(label);
+  if (!passEnabled("thread-jumps"))
+  { emitPatch(opLDA, pc, t, c);
+    unreachable = TRUE;
+    return;
+  }
+  for (i = 0; i < hereCount; i++)
+  { l = hereLabel[i];
+    if (l == t)
+    { /* a jump to itself stays */
+      hereLabel[n++] = l;
+      continue;
+    }
+    labelAlias[l] = t;
+    if (labelLoc[t] >= 0)
+      patch(l, labelLoc[t]);
+    else
+      while (labelPatch[l] >= 0)
+      { loc = labelPatch[l];
+        labelPatch[l] = buffer[loc].d;
+        buffer[loc].d = labelPatch[t];
+        labelPatch[t] = loc;
+      }
+  }
+  hereCount = n;
+  if (!unreachable || n > 0)
+    emitPatch(opLDA, pc, t, c);
+  else
+    probe = NULL;
+  unreachable = TRUE;
+}
+
+/* Procedure emitPrelude emits the standard
+ * prelude and the call of main, at mainLabel,
+ * which returns to a HALT. codefile names the
+ * code file in a comment
+ */
+void emitPrelude(char * codefile, int mainLabel)
+{ char * s = malloc(strlen(codefile) + 7);
+  strcpy(s, "File: ");
+  strcat(s, codefile);
+  emitComment("TINY Compilation to TM Code");
+  emitComment(s);
+  free(s);
+  emitComment("Standard prelude:");
+  emitRM(opLD, mp, 0, ac, "load maxaddress from location 0");
+  emitRM(opST, ac, 0, ac, "clear location 0");
+  emitComment("End of standard prelude.");
+  emitJump(opCALL, mp, mainLabel, "call main");
+  emitComment("End of execution.");
+  emitRO(opHALT, 0, 0, 0, "done");
+}
+
+/* Function emitBuiltin emits the body of the
+ * builtin function name, input or output, and
+ * returns FALSE if name is neither
+ */
+int emitBuiltin(char * name)
+{ if (strcmp(name, "input") == 0)
+  { emitRO(opIN, ac, 0, 0, "read integer value");
+    emitRM(opRET, mp, 0, 0, "return and pop arguments");
+    return TRUE;
+  }
+  if (strcmp(name, "output") == 0)
+  { emitRM(opLD, ac, 1, mp, "load first argument");
+    emitRO(opOUT, ac, 0, 0, "write ac");
+    emitRM(opRET, mp, 1, 0, "return and pop arguments");
+    return TRUE;
+  }
+  return FALSE;
+}
+
+/* Procedure emitReturn pops the frame and fp and
+ * returns, popping the nparams arguments
+ */
+void emitReturn(int nparams)
+{ emitRM(opLEAVE, fp, 0, mp, "return: pop frame and fp");
+  emitRM(opRET, mp, nparams, 0, "return and pop arguments");
+}
+
+/* Function tailCallBase returns the fp offset the
+ * return address goes to for a tail call with n
+ * arguments from a function with nparams: the
+ * arguments end at the top of its parameter area
+ * and the return address goes right below them,
+ * so that the callee's RET leaves mp where the
+ * caller's would have
+ */
+int tailCallBase(int nparams, int n)
+{ return PARAMOFFSET - 1 + nparams - n;
+}
+
+/* Function passesLocalArray returns TRUE if call
+ * passes the address of a local array, which a
+ * tail call reusing the frame would free
+ */
+int passesLocalArray(TreeNode * call)
+{ TreeNode * p;
+  for (p = call->child[0]; p != NULL; p = p->sibling)
+    if (p->nodekind == ExpK && p->kind.exp == IdArrayK
+        && p->child[0] == NULL && p->sym != NULL
+        && p->sym->storage == LocalS)
+      return TRUE;
+  return FALSE;
+}
+
+/* Procedure emitTailArguments copies the n
+ * arguments of a tail call, pushed first lowest
+ * from mp+first, into place above tailCallBase.
+ * They lie below the frame, so copying the last
+ * one first never overwrites one not yet copied.
+ * If they cover the saved fp, the return address
+ * and saved fp are first loaded into ac1 and ac2
+ * for emitTailFrame
+ */
+void emitTailArguments(int nparams, int n, int first)
+{ int base = tailCallBase(nparams, n), i;
+  if (base < 1)
+  { emitRM(opLD, ac1, 1, fp, "tail call: load return address");
+    emitRM(opLD, ac2, 0, fp, "tail call: load saved fp");
+  }
+  for (i = n; i >= 1; i--)
+  { emitRM(opLD, ac, first + i - 1, mp, "tail call: load argument");
+    emitRM(opST, ac, base + i, fp, "tail call: store argument");
+  }
+}
+
+/* Procedure emitTailFrame pops the frame for a
+ * tail call with n arguments in place from a
+ * function with nparams, moving the return
+ * address below them and restoring fp. The jump
+ * to the callee follows
+ */
+void emitTailFrame(int nparams, int n)
+{ int base = tailCallBase(nparams, n);
+  if (base == 1)
+    emitRM(opLEAVE, fp, 0, mp, "tail call: pop frame and fp");
+  else if (base > 1)
+  { emitRM(opLD, ac1, 1, fp, "tail call: load return address");
+    emitRM(opST, ac1, base, fp, "tail call: move return address");
+    emitRM(opLDA, mp, base, fp, "tail call: mp at return address");
+    emitRM(opLD, fp, 0, fp, "tail call: restore fp");
+  }
+  else
+  { emitRM(opST, ac1, base, fp, "tail call: move return address");
+    emitRM(opLDA, mp, base, fp, "tail call: mp at return address");
+    emitRM(opLDA, fp, 0, ac2, "tail call: restore fp");
+  }
+}
+
+/* Procedure resetCode starts emitting at
+ * location 0 again, as for a new code file
+ */
+void resetCode(void)
+{ emitLoc = 0;
+  poolSize = 0;
+  notes = -1;
+  probe = NULL;
+  hereCount = 0;
+  unreachable = FALSE;
+}
+
+/* Function codeSize returns the number of
+ * instructions emitted so far and kept
+ */
+int codeSize(void)
+{ int loc, n = 0;
+  for (loc = 0; loc < emitLoc; loc++)
+    if (buffer[loc].kept)
+      n++;
+  return n;
+}
+
+/* Function codeBuffer returns the instructions
+ * emitted so far, indexed by location, and sets
+ * n to their number
+ */
+Instr * codeBuffer(int * n)
+{ *n = emitLoc;
+  return buffer;
+}
+
+/* Function renumber numbers the instructions kept
+ * in the code buffer afresh, adjusts their
+ * pc-relative offsets to match, and returns the
+ * new location of each location. A deleted
+ * instruction's location becomes that of the next
+ * one kept
+ */
+static int * renumber(void)
+{ Instr * i;
+  int * newLoc = (int *) malloc((emitLoc + 1) * sizeof(int));
+  int loc, n = 0;
+  for (loc = 0; loc < emitLoc; loc++)
+  { newLoc[loc] = n;
+    if (buffer[loc].kept)
+      n++;
+  }
+  newLoc[emitLoc] = n;
+  for (loc = 0; loc < emitLoc; loc++)
+  { i = &buffer[loc];
+    if (i->kept && i->target >= 0 && i->target <= emitLoc)
+      i->d = newLoc[i->target] - (newLoc[loc] + 1);
+  }
+  return newLoc;
+}
+
+/* Function finalCode returns a copy of the
+ * instructions kept in the code buffer, numbered
+ * as writeCode numbers them, and sets n to their
+ * number
+ */
+Instr * finalCode(int * n)
+{ int * newLoc = renumber();
+  Instr * final;
+  int loc;
+  *n = newLoc[emitLoc];
+  final = (Instr *) malloc((*n + 1) * sizeof(Instr));
+  for (loc = 0; loc < emitLoc; loc++)
+    if (buffer[loc].kept)
+      final[newLoc[loc]] = buffer[loc];
+  free(newLoc);
+  return final;
+}
+
+/* Procedure writeCode writes the instructions
+ * kept in the code buffer to the code file,
+ * numbering them afresh and adjusting the
+ * pc-relative offsets to match
+ */
+void writeCode(void)
+{ Instr * i;
+  int * newLoc = renumber();
+  int loc;
+  for (loc = 0; loc < emitLoc; loc++)
+  { i = &buffer[loc];
+    if (i->notes >= 0)
+      fputs(pool + i->notes, code);
+    if (!i->kept)
+      continue;
+    if (i->probe != NULL)
+      fprintf(code,"*@%s\n",i->probe);
+    if (isRO(i->op))
+      fprintf(code,"%3d:  %5s  %d,%d,%d ",newLoc[loc],opName[i->op],i->r,i->s,i->t);
+    else
+      fprintf(code,"%3d:  %5s  %d,%d(%d) ",newLoc[loc],opName[i->op],i->r,i->d,i->s);
+    if (TraceCode) fprintf(code,"\t%s",pool + i->c) ;
+    fprintf(code,"\n") ;
+  }
+  if (notes >= 0)
+    fwrite(pool + notes, 1, poolSize - notes, code);
+  free(newLoc);
+}
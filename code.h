@@ -31,6 +31,54 @@
 /* 2nd accumulator */
 #define  ac1 1
 
+/* registers 2 and 3 are not used by the
+ * calling convention; they hold expression
+ * temporaries or register variables
+ */
+#define  ac2 2
+#define  ac3 3
+
+/* Frame layout set up by CALL and ENTER:
+     fp+0        saved fp
+     fp+1        return address
+     fp+2 ...    arguments, first argument lowest
+   PARAMOFFSET is the fp offset of the first argument
+*/
+#define PARAMOFFSET 2
+
+/* TmOp is a TM opcode, numbered as in tm.c */
+typedef enum
+   { opHALT, opIN, opOUT, opADD, opSUB, opMUL, opDIV, opMOD,
+     opLD, opST, opLDA, opLDC, opJLT, opJLE, opJGT, opJGE,
+     opJEQ, opJNE, opSHL, opSHR, opCALL, opRET, opENTER, opLEAVE
+   } TmOp;
+
+/* isRO is TRUE for the register-only opcodes, and
+ * isBranch for the conditional jumps
+ */
+#define isRO(op) ((op) < opLD)
+#define isBranch(op) ((op) >= opJLT && (op) <= opJNE)
+
+/* An Instr is an instruction held in the code
+ * buffer until the code file is written. RO
+ * instructions use r, s and t, the others r, d
+ * and s. target is the location a pc-relative
+ * instruction goes to, or -1. c and notes are
+ * where the comment pool holds the comment and
+ * the comment lines written before the
+ * instruction, or -1. probe is the probe it
+ * carries for tm to count, or NULL
+ */
+typedef struct
+   { TmOp op;
+     int r, s, t, d;
+     int target;
+     int kept; /* FALSE once deleted */
+     int c;
+     int notes;
+     char * probe;
+   } Instr;
+
 /* code emitting utilities */
 
 /* Procedure emitComment prints a comment line 
@@ -38,6 +86,12 @@
  */
 void emitComment( char * c );
 
+/* Procedure emitProbe makes the next instruction
+ * carry probe p, written before it as a *@ line
+ * for tm to count it by
+ */
+void emitProbe( char * p );
+
 /* Procedure emitRO emits a register-only
  * TM instruction
  * op = the opcode
@@ -46,7 +100,7 @@ void emitComment( char * c );
  * t = 2nd source register
  * c = a comment to be printed if TraceCode is TRUE
  */
-void emitRO( char *op, int r, int s, int t, char *c);
+void emitRO( TmOp op, int r, int s, int t, char *c);
 
 /* Procedure emitRM emits a register-to-memory
  * TM instruction
@@ -56,24 +110,7 @@ void emitRO( char *op, int r, int s, int t, char *c);
  * s = the base register
  * c = a comment to be printed if TraceCode is TRUE
  */
-void emitRM( char * op, int r, int d, int s, char *c);
-
-/* Function emitSkip skips "howMany" code
- * locations for later backpatch. It also
- * returns the current code position
- */
-int emitSkip( int howMany);
-
-/* Procedure emitBackup backs up to 
- * loc = a previously skipped location
- */
-void emitBackup( int loc);
-
-/* Procedure emitRestore restores the current 
- * code position to the highest previously
- * unemitted position
- */
-void emitRestore(void);
+void emitRM( TmOp op, int r, int d, int s, char *c);
 
 /* Procedure emitRM_Abs converts an absolute reference 
  * to a pc-relative reference when emitting a
@@ -83,6 +120,106 @@ void emitRestore(void);
  * a = the absolute location in memory
  * c = a comment to be printed if TraceCode is TRUE
  */
-void emitRM_Abs( char *op, int r, int a, char * c);
+void emitRM_Abs( TmOp op, int r, int a, char * c);
+
+/* Function newLabel returns a new label for
+ * jumps whose target is not yet generated
+ */
+int newLabel(void);
+
+/* Procedure placeLabel places label at the
+ * current location. A jump just emitted to
+ * this location is dropped
+ */
+void placeLabel(int label);
+
+/* Procedure emitJump emits the conditional jump
+ * op on register r to label
+ */
+void emitJump( TmOp op, int r, int label, char * c);
+
+/* Procedure emitGoto emits an unconditional jump
+ * to label. Labels placed here are threaded to
+ * label instead, and the jump is left out when
+ * nothing else reaches it
+ */
+void emitGoto( int label, char * c);
+
+/* the calling convention, shared by the code
+   generators */
+
+/* Procedure emitPrelude emits the standard
+ * prelude and the call of main, at mainLabel,
+ * which returns to a HALT. codefile names the
+ * code file in a comment
+ */
+void emitPrelude(char * codefile, int mainLabel);
+
+/* Function emitBuiltin emits the body of the
+ * builtin function name, input or output, and
+ * returns FALSE if name is neither
+ */
+int emitBuiltin(char * name);
+
+/* Procedure emitReturn pops the frame and fp and
+ * returns, popping the nparams arguments
+ */
+void emitReturn(int nparams);
+
+/* Function tailCallBase returns the fp offset the
+ * return address goes to for a tail call with n
+ * arguments from a function with nparams
+ */
+int tailCallBase(int nparams, int n);
+
+/* Function passesLocalArray returns TRUE if call
+ * passes the address of a local array, which a
+ * tail call reusing the frame would free
+ */
+int passesLocalArray(TreeNode * call);
+
+/* Procedure emitTailArguments copies the n
+ * arguments of a tail call, pushed first lowest
+ * from mp+first, into place above tailCallBase
+ */
+void emitTailArguments(int nparams, int n, int first);
+
+/* Procedure emitTailFrame pops the frame for a
+ * tail call with n arguments in place from a
+ * function with nparams, moving the return
+ * address below them and restoring fp. The jump
+ * to the callee follows
+ */
+void emitTailFrame(int nparams, int n);
+
+/* Procedure resetCode starts emitting at
+ * location 0 again, as for a new code file
+ */
+void resetCode(void);
+
+/* Function codeSize returns the number of
+ * instructions emitted so far and kept
+ */
+int codeSize(void);
+
+/* Function codeBuffer returns the instructions
+ * emitted so far, indexed by location, and sets
+ * n to their number
+ */
+Instr * codeBuffer(int * n);
+
+/* Function finalCode returns a copy of the
+ * instructions kept in the code buffer, numbered
+ * as writeCode numbers them, and sets n to their
+ * number
+ */
+Instr * finalCode(int * n);
+
+/* Procedure writeCode writes the instructions
+ * kept in the code buffer to the code file,
+ * numbering them afresh and adjusting the
+ * pc-relative offsets to match
+ */
+void writeCode(void);
 
 #endif
@@ -0,0 +1,422 @@
+/****************************************************/
+/* File: cse.c                                      */
+/* Common subexpression elimination within basic    */
+/* blocks for the C- compiler: local value          */
+/* numbering over the syntax tree, visiting each    */
+/* block's expressions in the order cgen evaluates  */
+/* them, and of the addresses of the array         */
+/* parameter elements they load and store           */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "cse.h"
+
+/* An Available is an expression computed earlier
+ * in the block whose value still holds, with the
+ * later nodes that compute it again
+ */
+typedef struct availRec
+   { TreeNode * exp;
+     TreeNode ** reuse;
+     int reuses;
+     struct availRec * next;
+   } * Available;
+
+static Available avail = NULL;
+
+/* the block new locals are declared in */
+static TreeNode * scope;
+
+/* TRUE while numbering the addresses of array
+   parameter elements rather than values */
+static int addressing;
+
+/* number of the next temporary */
+static int tempCount;
+
+/* counts for the report */
+static int reused;
+static int temps;
+static int addrReused;
+static int addrTemps;
+
+/* Function cost estimates the TM instructions
+ * computing t takes, or returns -1 if t has an
+ * effect besides its value
+ */
+static int cost(TreeNode * t)
+{ int a, b;
+  switch (t->kind.exp)
+  { case ConstK:
+    case IdK:
+      return 0;
+    case IdArrayK:
+      if (t->child[0] == NULL)
+        return 1;
+      a = cost(t->child[0]);
+      if (a < 0)
+        return -1;
+      return a + (t->sym->storage == ParamS ? 3 : 2);
+    case OpK:
+      a = cost(t->child[0]);
+      b = cost(t->child[1]);
+      if (a < 0 || b < 0)
+        return -1;
+      return a + b + 1;
+    default:
+      return -1;
+  }
+}
+
+/* Function isCandidate returns TRUE if computing t
+ * once more costs more than keeping its value
+ */
+static int isCandidate(TreeNode * t)
+{ return (t->kind.exp == OpK
+          || (t->kind.exp == IdArrayK && t->child[0] != NULL))
+         && cost(t) >= 2;
+}
+
+/* Function isAddress returns TRUE if t accesses
+ * an element of an array parameter by an index
+ * free of effects: the array's address is loaded
+ * and added to it each time, which an address
+ * kept in a temporary saves
+ */
+static int isAddress(TreeNode * t)
+{ return t->kind.exp == IdArrayK && t->child[0] != NULL
+         && t->sym->storage == ParamS && cost(t->child[0]) >= 0;
+}
+
+/* Function reads returns TRUE if t reads the
+ * scalar with symbol sym
+ */
+static int reads(TreeNode * t, Symbol * sym)
+{ int i;
+  if (t == NULL)
+    return FALSE;
+  if (t->kind.exp == IdK && t->sym == sym)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    if (reads(t->child[i], sym))
+      return TRUE;
+  return FALSE;
+}
+
+/* Function loads returns TRUE if t loads an
+ * element of an array a store to array sym may
+ * change, or of any array if sym is NULL. An
+ * array parameter may be any global array or
+ * array of a caller, but not one of our locals
+ */
+static int loads(TreeNode * t, Symbol * sym)
+{ int i;
+  if (t == NULL)
+    return FALSE;
+  if (t->kind.exp == IdArrayK && t->child[0] != NULL
+      && (sym == NULL || t->sym == sym
+          || (sym->storage != LocalS && t->sym->storage != LocalS)))
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    if (loads(t->child[i], sym))
+      return TRUE;
+  return FALSE;
+}
+
+/* Function readsGlobal returns TRUE if t reads a
+ * global scalar
+ */
+static int readsGlobal(TreeNode * t)
+{ int i;
+  if (t == NULL)
+    return FALSE;
+  if (t->kind.exp == IdK && t->sym != NULL && t->sym->storage == GlobalS)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    if (readsGlobal(t->child[i]))
+      return TRUE;
+  return FALSE;
+}
+
+/* Function newTemp returns a new local declared
+ * in the current scope, named for its kind
+ */
+static Symbol * newTemp(char * kind, int lineno)
+{ Symbol * sym;
+  TreeNode * decl;
+  sym = (Symbol *) malloc(sizeof(Symbol));
+  sym->name = (char *) malloc(16);
+  sprintf(sym->name, "%s.%d", kind, ++tempCount);
+  sym->storage = LocalS;
+  sym->offset = 0;
+  sym->size = 1;
+  decl = newExpNode(VarK);
+  decl->type = Integer;
+  decl->lineno = lineno;
+  decl->attr.name = sym->name;
+  decl->sym = sym;
+  decl->sibling = scope->child[0];
+  scope->child[0] = decl;
+  return sym;
+}
+
+/* Procedure transformAddress gives the address
+ * of the element accessed by available a a
+ * temporary if it is accessed again: the first
+ * access sets it, and all go through it as
+ * elements of the pseudo array mem
+ */
+static void transformAddress(Available a)
+{ TreeNode * base, * t;
+  Symbol * sym;
+  int i;
+  sym = newTemp("addr", a->exp->lineno);
+  base = newExpNode(IdArrayK);
+  base->type = Integer;
+  base->lineno = a->exp->lineno;
+  base->attr.name = a->exp->sym->name;
+  base->sym = a->exp->sym;
+  a->exp->child[0] = newAssign(sym, newOp(PLUS, base, a->exp->child[0]));
+  a->exp->sym = &memory;
+  a->exp->attr.name = memory.name;
+  for (i = 0; i < a->reuses; i++)
+  { t = a->reuse[i];
+    t->sym = &memory;
+    t->attr.name = memory.name;
+    t->child[0] = newId(sym, t->lineno);
+  }
+  addrTemps++;
+  addrReused += a->reuses;
+}
+
+/* Procedure transform gives the expression of
+ * available a a temporary if it is computed
+ * again: its first computation assigns it, and
+ * the later ones read it
+ */
+static void transform(Available a)
+{ TreeNode * orig, * id;
+  Symbol * sym;
+  int i;
+  if (a->reuses == 0)
+    return;
+  if (addressing)
+  { transformAddress(a);
+    return;
+  }
+  sym = newTemp("cse", a->exp->lineno);
+  /* the first computation, in place */
+  orig = (TreeNode *) malloc(sizeof(TreeNode));
+  *orig = *a->exp;
+  orig->sibling = NULL;
+  id = newExpNode(IdK);
+  id->type = Integer;
+  id->lineno = a->exp->lineno;
+  id->attr.name = sym->name;
+  id->sym = sym;
+  a->exp->kind.exp = AssignK;
+  a->exp->attr.name = NULL;
+  a->exp->sym = NULL;
+  a->exp->child[0] = id;
+  a->exp->child[1] = orig;
+  a->exp->child[2] = NULL;
+  for (i = 0; i < a->reuses; i++)
+  { a->reuse[i]->kind.exp = IdK;
+    a->reuse[i]->attr.name = sym->name;
+    a->reuse[i]->sym = sym;
+    a->reuse[i]->child[0] = NULL;
+    a->reuse[i]->child[1] = NULL;
+  }
+  temps++;
+  reused += a->reuses;
+}
+
+/* Procedure forget drops the available
+ * expressions for which kills returns TRUE,
+ * or the addresses whose index it kills
+ */
+static void forget(int (* kills) (TreeNode *, Symbol *), Symbol * sym)
+{ Available * link = &avail, a;
+  while ((a = *link) != NULL)
+    if (kills(addressing ? a->exp->child[0] : a->exp, sym))
+    { *link = a->next;
+      transform(a);
+      free(a->reuse);
+      free(a);
+    }
+    else
+      link = &a->next;
+}
+
+/* a call may change the globals and any array */
+static int killsCall(TreeNode * t, Symbol * sym)
+{ (void) sym;
+  return readsGlobal(t) || loads(t, NULL);
+}
+
+static int killsAll(TreeNode * t, Symbol * sym)
+{ (void) t;
+  (void) sym;
+  return TRUE;
+}
+
+/* Procedure endBlock closes the current basic
+ * block: nothing stays available after it
+ */
+static void endBlock(void)
+{ forget(killsAll, NULL);
+}
+
+/* Procedure visit numbers the expression t and
+ * those in it in evaluation order
+ */
+static void visit(TreeNode * t)
+{ Available a;
+  TreeNode * p, * args[64], * a1, * a2;
+  int n, candidate;
+  if (t == NULL)
+    return;
+  candidate = addressing ? isAddress(t) : isCandidate(t);
+  if (candidate)
+    for (a = avail; a != NULL; a = a->next)
+      if (sameExp(a->exp, t))
+      { a->reuse = (TreeNode **) realloc(a->reuse,
+                      (a->reuses + 1) * sizeof(TreeNode *));
+        a->reuse[a->reuses++] = t;
+        return;
+      }
+  switch (t->kind.exp)
+  { case OpK:
+      if (!(candidate && isModulo(t, &a1, &a2)))
+      { visit(t->child[0]);
+        visit(t->child[1]);
+      }
+      break;
+    case IdArrayK:
+      visit(t->child[0]);
+      break;
+    case AssignK:
+      /* cgen evaluates the value before the index */
+      visit(t->child[1]);
+      if (t->child[0]->kind.exp == IdArrayK)
+      { /* a store needs the address, not the value */
+        visit(addressing ? t->child[0] : t->child[0]->child[0]);
+        forget(loads, t->child[0]->sym);
+      }
+      else
+        forget(reads, t->child[0]->sym);
+      break;
+    case CallK:
+      /* arguments are pushed last first */
+      n = 0;
+      for (p = t->child[0]; p != NULL && n < 64; p = p->sibling)
+        args[n++] = p;
+      while (n > 0)
+        visit(args[--n]);
+      forget(killsCall, NULL);
+      break;
+    default:
+      break;
+  }
+  if (candidate)
+  { a = (Available) malloc(sizeof(struct availRec));
+    a->exp = t;
+    a->reuse = NULL;
+    a->reuses = 0;
+    a->next = avail;
+    avail = a;
+  }
+}
+
+/* Procedure cseStmts numbers the expressions of
+ * a statement list, block by block
+ */
+static void cseStmts(TreeNode * t)
+{ TreeNode * saved;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK)
+    { visit(t);
+      continue;
+    }
+    switch (t->kind.stmt)
+    { case IfK:
+        visit(t->child[0]);
+        endBlock();
+        cseStmts(t->child[1]);
+        endBlock();
+        cseStmts(t->child[2]);
+        endBlock();
+        break;
+      case WhileK:
+        /* the test is reached from the entry and
+           from the end of the body */
+        endBlock();
+        cseStmts(t->child[1]);
+        endBlock();
+        visit(t->child[0]);
+        endBlock();
+        break;
+      case ReturnK:
+        visit(t->child[0]);
+        endBlock();
+        break;
+      case CompoundK:
+        /* temporaries live in the block they are
+           declared in, so values are not kept
+           across its ends */
+        endBlock();
+        saved = scope;
+        scope = t;
+        cseStmts(t->child[1]);
+        endBlock();
+        scope = saved;
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+/* Procedure eliminateCommonSubexps keeps the value
+ * of a pure expression computed more than once in
+ * a basic block in a new local, and uses that local
+ * for the later computations
+ */
+void eliminateCommonSubexps(TreeNode * syntaxTree)
+{ TreeNode * t;
+  reused = 0;
+  temps = 0;
+  tempCount = 0;
+  addressing = FALSE;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+      cseStmts(t->child[1]);
+  if (TraceOptimize)
+    fprintf(listing, "\nCommon subexpressions:\n  %d computations reused "
+            "from %d temporaries\n", reused, temps);
+}
+
+/* Procedure reuseAddresses keeps the address of an
+ * element of an array parameter loaded or stored
+ * more than once in a basic block in a new local,
+ * and accesses the element through it. It runs
+ * after the loop pass, which steps addresses
+ * through the loops it can
+ */
+void reuseAddresses(TreeNode * syntaxTree)
+{ TreeNode * t;
+  addrReused = 0;
+  addrTemps = 0;
+  tempCount = 0;
+  addressing = TRUE;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+      cseStmts(t->child[1]);
+  addressing = FALSE;
+  if (TraceOptimize)
+    fprintf(listing, "\nCommon addresses:\n  %d addresses reused from %d "
+            "temporaries\n", addrReused, addrTemps);
+}
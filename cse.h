@@ -0,0 +1,24 @@
+/****************************************************/
+/* File: cse.h                                      */
+/* Common subexpression elimination within basic    */
+/* blocks for the C- compiler                       */
+/****************************************************/
+
+#ifndef _CSE_H_
+#define _CSE_H_
+
+/* Procedure eliminateCommonSubexps keeps the value
+ * of a pure expression computed more than once in
+ * a basic block in a new local, and uses that local
+ * for the later computations
+ */
+void eliminateCommonSubexps(TreeNode * syntaxTree);
+
+/* Procedure reuseAddresses keeps the address of an
+ * element of an array parameter loaded or stored
+ * more than once in a basic block in a new local,
+ * and accesses the element through it
+ */
+void reuseAddresses(TreeNode * syntaxTree);
+
+#endif
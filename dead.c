@@ -0,0 +1,523 @@
+/****************************************************/
+/* File: dead.c                                     */
+/* Dead code removal over the syntax tree for the   */
+/* C- compiler: backward liveness over each         */
+/* function drops the stores to locals never read   */
+/* again, and reachability over the call graph from */
+/* main drops the functions and globals not needed  */
+/****************************************************/
+
+#include "globals.h"
+#include "dead.h"
+
+/* MAXVARS is the number of scalars of a function
+   whose stores are considered */
+#define MAXVARS 32
+
+/* a VarSet has bit i set for candidate i */
+typedef unsigned int VarSet;
+
+#define BIT(v) (((VarSet) 1) << (v))
+
+/* the candidates: scalar locals and parameters,
+   identified by their symbol */
+static Symbol * varSym[MAXVARS];
+static int varCount = 0;
+
+/* sweep is TRUE on the final pass over a
+   statement, when the live sets are settled and
+   the dead code in it is removed */
+static int sweep;
+
+/* A SymSet is a growable set of symbols */
+typedef struct
+   { Symbol ** sym;
+     int count;
+     int max;
+   } SymSet;
+
+/* the functions main can call, and the globals
+   they read */
+static SymSet called = { NULL, 0, 0 };
+static SymSet readGlobals = { NULL, 0, 0 };
+
+/* counts for the report */
+static int stores;
+static int results;
+static int locals;
+static int functions;
+static int globals;
+
+/* Function include adds sym to set s and returns
+ * TRUE if it was not there yet
+ */
+static int include(SymSet * s, Symbol * sym)
+{ int k;
+  for (k = 0; k < s->count; k++)
+    if (s->sym[k] == sym)
+      return FALSE;
+  if (s->count == s->max)
+  { s->max = s->max == 0 ? 32 : s->max * 2;
+    s->sym = (Symbol **) realloc(s->sym, s->max * sizeof(Symbol *));
+  }
+  s->sym[s->count++] = sym;
+  return TRUE;
+}
+
+/* Function contains returns TRUE if sym is in
+ * set s
+ */
+static int contains(SymSet * s, Symbol * sym)
+{ int k;
+  for (k = 0; k < s->count; k++)
+    if (s->sym[k] == sym)
+      return TRUE;
+  return FALSE;
+}
+
+/* Function traps returns TRUE if operator node t
+ * divides by what may be zero
+ */
+static int traps(TreeNode * t)
+{ return t->kind.exp == OpK && t->attr.op == OVER
+         && !(t->child[1]->kind.exp == ConstK && t->child[1]->attr.val != 0);
+}
+
+/* Function hasEffect returns TRUE if evaluating
+ * expression t does more than compute its value
+ */
+static int hasEffect(TreeNode * t)
+{ TreeNode * p;
+  int i;
+  if (t->kind.exp == CallK || t->kind.exp == AssignK || traps(t))
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      if (hasEffect(p))
+        return TRUE;
+  return FALSE;
+}
+
+/* Function discard returns what must still be
+ * evaluated of expression t when its value is not
+ * used, or NULL if nothing
+ */
+static TreeNode * discard(TreeNode * t)
+{ TreeNode * a, * b;
+  if (!hasEffect(t))
+    return NULL;
+  switch (t->kind.exp)
+  { case OpK:
+      if (traps(t))
+        return t;
+      a = discard(t->child[0]);
+      b = discard(t->child[1]);
+      if (a == NULL)
+        return b;
+      return b == NULL ? a : t;
+    case IdArrayK:
+      return discard(t->child[0]);
+    default:
+      return t;
+  }
+}
+
+/* Procedure trim replaces the expression
+ * statement at *at by what must still be
+ * evaluated of it, or unlinks it if nothing
+ */
+static void trim(TreeNode ** at)
+{ TreeNode * t = *at, * d = discard(t);
+  if (d == t)
+    return;
+  if (d == NULL)
+    *at = t->sibling;
+  else
+  { d->sibling = t->sibling;
+    *at = d;
+  }
+  results++;
+}
+
+/* Procedure replaceBy replaces the assignment at
+ * *at by its right hand side
+ */
+static void replaceBy(TreeNode ** at)
+{ TreeNode * t = *at;
+  t->child[1]->sibling = t->sibling;
+  *at = t->child[1];
+  stores++;
+}
+
+/* Function candidate returns the candidate number
+ * of symbol sym, or -1
+ */
+static int candidate(Symbol * sym)
+{ int v;
+  for (v = 0; v < varCount; v++)
+    if (varSym[v] == sym)
+      return v;
+  return -1;
+}
+
+/* Procedure addCandidates makes candidates of the
+ * scalars in a declaration or parameter list
+ */
+static void addCandidates(TreeNode * t)
+{ for (; t != NULL; t = t->sibling)
+    if ((t->kind.exp == VarK || t->kind.exp == SingleParamK)
+        && t->sym != NULL && varCount < MAXVARS)
+      varSym[varCount++] = t->sym;
+}
+
+/* Procedure collect finds the candidates
+ * declared in the blocks of a statement list
+ */
+static void collect(TreeNode * t)
+{ int i;
+  for (; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK)
+    { if (t->kind.stmt == CompoundK)
+        addCandidates(t->child[0]);
+      for (i = 0; i < MAXCHILDREN; i++)
+        collect(t->child[i]);
+    }
+}
+
+static VarSet liveList(TreeNode ** list, VarSet out);
+
+/* Function liveExp returns the variables live
+ * before the expression at *at given those live
+ * after it, and when sweeping replaces each
+ * assignment to a dead candidate by its right
+ * hand side. Arguments are evaluated last to first
+ */
+static VarSet liveExp(TreeNode ** at, VarSet out)
+{ TreeNode * t = *at, ** q;
+  int v;
+  if (t == NULL)
+    return out;
+  switch (t->kind.exp)
+  { case IdK:
+      v = candidate(t->sym);
+      return v >= 0 ? out | BIT(v) : out;
+    case IdArrayK:
+      return liveExp(&t->child[0], out);
+    case OpK:
+      return liveExp(&t->child[0], liveExp(&t->child[1], out));
+    case AssignK:
+      if (t->child[0]->kind.exp == IdArrayK)
+        return liveExp(&t->child[1], liveExp(&t->child[0]->child[0], out));
+      v = candidate(t->child[0]->sym);
+      if (v >= 0 && !(out & BIT(v)) && sweep)
+      { replaceBy(at);
+        return liveExp(at, out);
+      }
+      if (v >= 0)
+        out &= ~BIT(v);
+      return liveExp(&t->child[1], out);
+    case CallK:
+      for (q = &t->child[0]; *q != NULL; q = &(*q)->sibling)
+        out = liveExp(q, out);
+      return out;
+    default:
+      return out;
+  }
+}
+
+/* Function liveStmt returns the variables live
+ * before the statement at *at given those live
+ * after it, removing its dead code when sweeping
+ */
+static VarSet liveStmt(TreeNode ** at, VarSet out)
+{ TreeNode * t = *at;
+  VarSet in, prev, body;
+  int swept;
+  if (t->nodekind == ExpK)
+  { in = liveExp(at, out);
+    if (sweep)
+      trim(at);
+    return in;
+  }
+  switch (t->kind.stmt)
+  { case CompoundK:
+      return liveList(&t->child[1], out);
+    case IfK:
+      return liveExp(&t->child[0], liveList(&t->child[1], out)
+                                   | liveList(&t->child[2], out));
+    case WhileK:
+      /* settle the loop before sweeping it */
+      swept = sweep;
+      sweep = FALSE;
+      in = liveExp(&t->child[0], out);
+      do
+      { prev = in;
+        body = liveList(&t->child[1], in);
+        in = liveExp(&t->child[0], out | body);
+      } while (in != prev);
+      sweep = swept;
+      if (sweep)
+        liveExp(&t->child[0], out | liveList(&t->child[1], in));
+      return in;
+    case ReturnK:
+      return liveExp(&t->child[0], 0);
+    default:
+      return out;
+  }
+}
+
+/* Function liveList returns the variables live
+ * before the statement list at *list
+ */
+static VarSet liveList(TreeNode ** list, VarSet out)
+{ if (*list == NULL)
+    return out;
+  out = liveList(&(*list)->sibling, out);
+  return liveStmt(list, out);
+}
+
+/* Function references returns TRUE if tree t or
+ * its siblings refer to symbol sym
+ */
+static int references(TreeNode * t, Symbol * sym)
+{ int i;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK && (t->kind.exp == IdK || t->kind.exp == IdArrayK)
+        && t->sym == sym)
+      return TRUE;
+    for (i = 0; i < MAXCHILDREN; i++)
+      if (references(t->child[i], sym))
+        return TRUE;
+  }
+  return FALSE;
+}
+
+/* Procedure removeLocals unlinks the declarations
+ * of the blocks under statement list t that the
+ * function body no longer refers to
+ */
+static void removeLocals(TreeNode * t, TreeNode * body)
+{ TreeNode ** d;
+  int i;
+  for (; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK)
+    { if (t->kind.stmt == CompoundK)
+      { for (d = &t->child[0]; *d != NULL; )
+          if (references(body, (*d)->sym))
+            d = &(*d)->sibling;
+          else
+          { *d = (*d)->sibling;
+            locals++;
+          }
+      }
+      for (i = 0; i < MAXCHILDREN; i++)
+        removeLocals(t->child[i], body);
+    }
+}
+
+/* Procedure removeDeadStores removes from each
+ * function the assignments to scalar locals whose
+ * values are never read, the parts of expression
+ * statements that have no effect, and the locals
+ * no longer referenced
+ */
+void removeDeadStores(TreeNode * syntaxTree)
+{ TreeNode * t;
+  int before;
+  stores = 0;
+  results = 0;
+  locals = 0;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+    { varCount = 0;
+      addCandidates(t->child[0]);
+      collect(t->child[1]);
+      sweep = TRUE;
+      /* removing a store may leave the stores that
+         fed it dead in turn */
+      do
+      { before = stores + results;
+        liveStmt(&t->child[1], 0);
+      } while (stores + results != before);
+      removeLocals(t->child[1], t->child[1]);
+    }
+  if (TraceOptimize)
+    fprintf(listing, "\nDead stores:\n  %d stores, %d unused results and "
+            "%d unused locals removed\n", stores, results, locals);
+}
+
+/* Function findFunction returns the declaration
+ * of the function with symbol sym
+ */
+static TreeNode * findFunction(TreeNode * syntaxTree, Symbol * sym)
+{ TreeNode * t;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->sym == sym)
+      return t;
+  return NULL;
+}
+
+/* Procedure markCalls adds to the reached set the
+ * functions tree t or its siblings call, and those
+ * they call in turn, and to the read set the
+ * globals they read. A scalar global assigned to
+ * is not read by the assignment
+ */
+static void markCalls(TreeNode * syntaxTree, TreeNode * t)
+{ TreeNode * f;
+  int i;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK)
+      switch (t->kind.exp)
+      { case CallK:
+          f = findFunction(syntaxTree, t->sym);
+          if (f != NULL && include(&called, t->sym))
+            markCalls(syntaxTree, f->child[1]);
+          break;
+        case IdK:
+        case IdArrayK:
+          if (t->sym != NULL && t->sym->storage == GlobalS)
+            include(&readGlobals, t->sym);
+          break;
+        case AssignK:
+          if (t->child[0]->kind.exp == IdK)
+          { markCalls(syntaxTree, t->child[1]);
+            continue;
+          }
+          break;
+        default:
+          break;
+      }
+    for (i = 0; i < MAXCHILDREN; i++)
+      markCalls(syntaxTree, t->child[i]);
+  }
+}
+
+/* Function isUnread returns TRUE if sym is a
+ * global no reached function reads
+ */
+static int isUnread(Symbol * sym)
+{ return sym != NULL && sym->storage == GlobalS && !contains(&readGlobals, sym);
+}
+
+/* Procedure dropExp replaces the assignments to
+ * unread globals in the expression at *at by
+ * their right hand sides
+ */
+static void dropExp(TreeNode ** at)
+{ TreeNode * t = *at, ** q;
+  int i;
+  if (t == NULL)
+    return;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (q = &t->child[i]; *q != NULL; q = &(*q)->sibling)
+      dropExp(q);
+  if (t->kind.exp == AssignK && t->child[0]->kind.exp == IdK
+      && isUnread(t->child[0]->sym))
+    replaceBy(at);
+}
+
+/* Procedure dropStmts removes the assignments to
+ * unread globals from the statement list at *list
+ */
+static void dropStmts(TreeNode ** list)
+{ TreeNode * t;
+  while ((t = *list) != NULL)
+  { if (t->nodekind == ExpK)
+    { dropExp(list);
+      trim(list);
+      if (*list == t->sibling)
+        continue;
+    }
+    else
+      switch (t->kind.stmt)
+      { case IfK:
+          dropExp(&t->child[0]);
+          dropStmts(&t->child[1]);
+          dropStmts(&t->child[2]);
+          break;
+        case WhileK:
+          dropExp(&t->child[0]);
+          dropStmts(&t->child[1]);
+          break;
+        case ReturnK:
+          dropExp(&t->child[0]);
+          break;
+        default:
+          dropStmts(&t->child[1]);
+          break;
+      }
+    list = &(*list)->sibling;
+  }
+}
+
+/* Function isNeeded returns TRUE if the global
+ * declaration t is still needed
+ */
+static int isNeeded(TreeNode * t)
+{ if (t->nodekind == StmtK)
+    return contains(&called, t->sym);
+  return contains(&readGlobals, t->sym);
+}
+
+/* Procedure tally counts the removal of the
+ * global declaration t
+ */
+static void tally(TreeNode * t)
+{ if (t->nodekind == StmtK)
+    functions++;
+  else
+    globals++;
+}
+
+/* Procedure removeUnreachable removes the
+ * functions main cannot call and the globals no
+ * remaining function reads, then gives the
+ * globals left consecutive locations
+ */
+void removeUnreachable(TreeNode * syntaxTree)
+{ TreeNode * t, ** at;
+  int location = 0, number = 0;
+  stores = 0;
+  results = 0;
+  functions = 0;
+  globals = 0;
+  called.count = 0;
+  readGlobals.count = 0;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && strcmp(t->attr.name, "main") == 0)
+    { include(&called, t->sym);
+      markCalls(syntaxTree, t->child[1]);
+    }
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && contains(&called, t->sym))
+      dropStmts(&t->child[1]);
+  /* main is kept, so a declaration follows any
+     that is unlinked; the head of the list is
+     replaced by the next in place */
+  while (!isNeeded(syntaxTree))
+  { tally(syntaxTree);
+    *syntaxTree = *syntaxTree->sibling;
+  }
+  for (at = &syntaxTree->sibling; *at != NULL; )
+    if (isNeeded(*at))
+      at = &(*at)->sibling;
+    else
+    { tally(*at);
+      *at = (*at)->sibling;
+    }
+  /* functions are numbered apart from the
+     variables, which take memory */
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK)
+      t->sym->offset = number++;
+    else
+    { t->sym->offset = location;
+      location += t->kind.exp == VarArrayK ? t->child[0]->attr.val : 1;
+    }
+  if (TraceOptimize)
+    fprintf(listing, "\nUnreachable code:\n  %d functions and %d globals "
+            "removed, %d stores to them and %d unused results dropped\n",
+            functions, globals, stores, results);
+}
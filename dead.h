@@ -0,0 +1,25 @@
+/****************************************************/
+/* File: dead.h                                     */
+/* Dead code removal over the syntax tree for the   */
+/* C- compiler                                      */
+/****************************************************/
+
+#ifndef _DEAD_H_
+#define _DEAD_H_
+
+/* Procedure removeDeadStores removes from each
+ * function the assignments to scalar locals whose
+ * values are never read, the parts of expression
+ * statements that have no effect, and the locals
+ * no longer referenced
+ */
+void removeDeadStores(TreeNode * syntaxTree);
+
+/* Procedure removeUnreachable removes the
+ * functions main cannot call and the globals no
+ * remaining function reads, then gives the
+ * globals left consecutive locations
+ */
+void removeUnreachable(TreeNode * syntaxTree);
+
+#endif
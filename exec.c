@@ -0,0 +1,205 @@
+/****************************************************/
+/* File: exec.c                                     */
+/* An embedded TM for the C- compiler: runs the     */
+/* code in the code buffer as tm runs a code file,  */
+/* with IN reading integers from stdin and OUT      */
+/* writing them to stdout, so a program can be run  */
+/* without the code file being written and parsed.  */
+/* It counts the probes as tm does and can write    */
+/* the profile tm would                             */
+/****************************************************/
+
+#include "globals.h"
+#include "code.h"
+#include "exec.h"
+
+/* DADDR_SIZE is the size of data memory, as in tm */
+#define DADDR_SIZE 1024
+
+/* NO_REGS is the number of registers */
+#define NO_REGS 8
+
+/* A StepResult is why the machine stopped */
+typedef enum
+   { srHALT, srIMEM_ERR, srDMEM_ERR, srZERODIVIDE, srIN_ERR
+   } StepResult;
+
+static char * stepResultTab[]
+   = { "Halted", "Instruction Memory Fault", "Data Memory Fault",
+       "Division by 0", "Bad input"
+     };
+
+static int dMem[DADDR_SIZE];
+static int reg[NO_REGS];
+
+/* the times each instruction carrying a probe was
+   run, and the times a probed jump was taken */
+static long * probeCount;
+static long * probeTaken;
+
+/* inData is TRUE if m is a data memory address */
+#define inData(m) ((m) >= 0 && (m) < DADDR_SIZE)
+
+/* Function execute runs the n instructions of prog
+ * from location 0 until one stops the machine,
+ * adding the instructions run to steps, and
+ * returns why it stopped
+ */
+static StepResult execute(Instr * prog, int n, long * steps)
+{ Instr * i;
+  int loc, m;
+  for (;;)
+  { loc = reg[pc];
+    if (loc < 0 || loc >= n)
+      return srIMEM_ERR;
+    i = &prog[loc];
+    reg[pc] = loc + 1;
+    (*steps)++;
+    if (i->probe != NULL)
+      probeCount[loc]++;
+    switch (i->op)
+    { case opHALT:
+        return srHALT;
+      case opIN:
+        if (scanf("%d", &reg[i->r]) != 1)
+          return srIN_ERR;
+        break;
+      case opOUT:
+        printf("%d\n", reg[i->r]);
+        break;
+      case opADD: reg[i->r] = reg[i->s] + reg[i->t]; break;
+      case opSUB: reg[i->r] = reg[i->s] - reg[i->t]; break;
+      case opMUL: reg[i->r] = reg[i->s] * reg[i->t]; break;
+      case opDIV:
+        if (reg[i->t] == 0)
+          return srZERODIVIDE;
+        reg[i->r] = reg[i->s] / reg[i->t];
+        break;
+      case opMOD:
+        if (reg[i->t] == 0)
+          return srZERODIVIDE;
+        reg[i->r] = reg[i->s] % reg[i->t];
+        break;
+      case opLD:
+        m = i->d + reg[i->s];
+        if (!inData(m))
+          return srDMEM_ERR;
+        reg[i->r] = dMem[m];
+        break;
+      case opST:
+        m = i->d + reg[i->s];
+        if (!inData(m))
+          return srDMEM_ERR;
+        dMem[m] = reg[i->r];
+        break;
+      case opLDA: reg[i->r] = i->d + reg[i->s]; break;
+      case opLDC: reg[i->r] = i->d; break;
+      case opJLT: if (reg[i->r] < 0) reg[pc] = i->d + reg[i->s]; break;
+      case opJLE: if (reg[i->r] <= 0) reg[pc] = i->d + reg[i->s]; break;
+      case opJGT: if (reg[i->r] > 0) reg[pc] = i->d + reg[i->s]; break;
+      case opJGE: if (reg[i->r] >= 0) reg[pc] = i->d + reg[i->s]; break;
+      case opJEQ: if (reg[i->r] == 0) reg[pc] = i->d + reg[i->s]; break;
+      case opJNE: if (reg[i->r] != 0) reg[pc] = i->d + reg[i->s]; break;
+      case opSHL:
+        reg[i->r] = (int) ((unsigned) reg[i->s] << (i->d & 31));
+        break;
+      case opSHR: reg[i->r] = reg[i->s] >> (i->d & 31); break;
+      case opCALL:
+        m = i->d + reg[i->s];
+        if (!inData(reg[i->r] - 1))
+          return srDMEM_ERR;
+        dMem[--reg[i->r]] = reg[pc];
+        reg[pc] = m;
+        break;
+      case opRET:
+        if (!inData(reg[i->r]))
+          return srDMEM_ERR;
+        reg[pc] = dMem[reg[i->r]];
+        reg[i->r] += i->d + 1;
+        break;
+      case opENTER:
+        if (!inData(reg[i->s] - 1))
+          return srDMEM_ERR;
+        dMem[--reg[i->s]] = reg[i->r];
+        reg[i->r] = reg[i->s];
+        reg[i->s] -= i->d;
+        break;
+      case opLEAVE:
+        if (!inData(reg[i->r]))
+          return srDMEM_ERR;
+        reg[i->s] = reg[i->r];
+        reg[i->r] = dMem[reg[i->s]++];
+        break;
+    }
+    if (i->probe != NULL && reg[pc] != loc + 1)
+      probeTaken[loc]++;
+  }
+}
+
+/* Procedure writeProfile writes the counts of the
+ * probes in the n instructions of prog, the code
+ * of codefile, to file in the form tm writes
+ * them. As in tm, a branch
+ * probe counts only on a conditional jump and a
+ * call probe only on a CALL or a jump
+ */
+static void writeProfile(Instr * prog, int n, char * codefile, char * file)
+{ FILE * prof;
+  char fn[128], what[128];
+  int loc, line, sense;
+  long yes;
+  Instr * i;
+  prof = fopen(file, "w");
+  if (prof == NULL)
+  { fprintf(stderr, "Unable to write profile %s\n", file);
+    return;
+  }
+  fprintf(prof, "* TM profile of %s\n", codefile);
+  for (loc = 0; loc < n; loc++)
+  { i = &prog[loc];
+    if (i->probe == NULL)
+      continue;
+    if (sscanf(i->probe, "branch %127s %d %127s %d",
+               fn, &line, what, &sense) == 4 && isBranch(i->op))
+    { yes = sense ? probeTaken[loc] : probeCount[loc] - probeTaken[loc];
+      fprintf(prof, "branch %s %d %s %ld %ld\n", fn, line, what,
+              yes, probeCount[loc] - yes);
+    }
+    else if (sscanf(i->probe, "call %127s %d %127s", fn, &line, what) == 3
+             && (i->op == opCALL || (i->op == opLDA && i->s == pc)))
+      fprintf(prof, "call %s %d %s %ld\n", fn, line, what, probeCount[loc]);
+  }
+  fclose(prof);
+  fprintf(listing, "Profile written to %s\n", file);
+}
+
+/* Function runCode runs the code in the code
+ * buffer on the embedded TM, with IN reading from
+ * stdin and OUT writing to stdout, and reports to
+ * the listing file how it stopped. If proffile is
+ * not NULL the counts of the probes are written
+ * to it as tm writes them for codefile. It
+ * returns TRUE if the program halted
+ */
+int runCode(char * codefile, char * proffile)
+{ Instr * prog;
+  int n;
+  long steps = 0;
+  StepResult result;
+  prog = finalCode(&n);
+  probeCount = (long *) calloc(n + 1, sizeof(long));
+  probeTaken = (long *) calloc(n + 1, sizeof(long));
+  memset(reg, 0, sizeof(reg));
+  memset(dMem, 0, sizeof(dMem));
+  dMem[0] = DADDR_SIZE - 1;
+  result = execute(prog, n, &steps);
+  fflush(stdout);
+  fprintf(listing, "\nTM: %s after %ld instructions\n",
+          stepResultTab[result], steps);
+  if (proffile != NULL)
+    writeProfile(prog, n, codefile, proffile);
+  free(probeCount);
+  free(probeTaken);
+  free(prog);
+  return result == srHALT;
+}
@@ -0,0 +1,19 @@
+/****************************************************/
+/* File: exec.h                                     */
+/* An embedded TM for the C- compiler               */
+/****************************************************/
+
+#ifndef _EXEC_H_
+#define _EXEC_H_
+
+/* Function runCode runs the code in the code
+ * buffer on the embedded TM, with IN reading from
+ * stdin and OUT writing to stdout, and reports to
+ * the listing file how it stopped. If proffile is
+ * not NULL the counts of the probes are written
+ * to it as tm writes them for codefile. It
+ * returns TRUE if the program halted
+ */
+int runCode(char * codefile, char * proffile);
+
+#endif
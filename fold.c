@@ -0,0 +1,228 @@
+/****************************************************/
+/* File: fold.c                                     */
+/* Constant folding and algebraic simplification    */
+/* of the syntax tree for the C- compiler           */
+/****************************************************/
+
+#include "globals.h"
+#include "fold.h"
+#include <limits.h>
+
+/* counts for the report */
+static int folded;
+static int simplified;
+static int removed;
+
+/* Function isConst returns TRUE if t is the
+ * constant val
+ */
+static int isConst(TreeNode * t, int val)
+{ return t->nodekind == ExpK && t->kind.exp == ConstK && t->attr.val == val;
+}
+
+/* Function isPure returns TRUE if evaluating t
+ * has no effect besides its value: no call, no
+ * assignment and no division that could trap
+ */
+static int isPure(TreeNode * t)
+{ TreeNode * p;
+  int i;
+  if (t->nodekind != ExpK || t->kind.exp == CallK || t->kind.exp == AssignK
+      || (t->kind.exp == OpK && t->attr.op == OVER))
+    return FALSE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      if (!isPure(p))
+        return FALSE;
+  return TRUE;
+}
+
+/* Function evaluate computes a op b the way the
+ * TM does: arithmetic wraps around, and the
+ * relations compare a-b with 0. It returns FALSE
+ * for a division the TM would trap on
+ */
+int evaluate(TokenType op, int a, int b, int * val)
+{ int d = (int) ((unsigned) a - (unsigned) b);
+  switch (op)
+  { case PLUS:  *val = (int) ((unsigned) a + (unsigned) b); break;
+    case MINUS: *val = d; break;
+    case TIMES: *val = (int) ((unsigned) a * (unsigned) b); break;
+    case OVER:
+      if (b == 0 || (b == -1 && a == INT_MIN))
+        return FALSE;
+      *val = a / b;
+      break;
+    case LT: *val = d < 0; break;
+    case LE: *val = d <= 0; break;
+    case GT: *val = d > 0; break;
+    case GE: *val = d >= 0; break;
+    case EQ: *val = d == 0; break;
+    case NE: *val = d != 0; break;
+    default: return FALSE;
+  }
+  return TRUE;
+}
+
+/* Procedure makeConst turns node t into the
+ * constant val
+ */
+static void makeConst(TreeNode * t, int val)
+{ t->kind.exp = ConstK;
+  t->attr.val = val;
+  t->child[0] = NULL;
+  t->child[1] = NULL;
+  t->type = Integer;
+}
+
+/* Procedure replace puts subtree s in the place
+ * of node t
+ */
+static void replace(TreeNode * t, TreeNode * s)
+{ TreeNode * sibling = t->sibling;
+  *t = *s;
+  t->sibling = sibling;
+  simplified++;
+}
+
+/* Procedure foldExp folds the expression t */
+static void foldExp(TreeNode * t)
+{ TreeNode * a, * b, * p;
+  int i, val;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      foldExp(p);
+  if (t->kind.exp != OpK)
+    return;
+  a = t->child[0];
+  b = t->child[1];
+  if (a->kind.exp == ConstK && b->kind.exp == ConstK)
+  { if (evaluate(t->attr.op, a->attr.val, b->attr.val, &val))
+    { makeConst(t, val);
+      folded++;
+    }
+    return;
+  }
+  /* constants go to the right of + and *,
+     where cgen makes them immediates */
+  if ((t->attr.op == PLUS || t->attr.op == TIMES) && a->kind.exp == ConstK)
+  { t->child[0] = b;
+    t->child[1] = a;
+    a = t->child[0];
+    b = t->child[1];
+  }
+  if (b->kind.exp != ConstK)
+    return;
+  switch (t->attr.op)
+  { case PLUS:
+    case MINUS:
+      /* (x + c1) + c2 is x + (c1 + c2) */
+      if (a->kind.exp == OpK && a->child[1]->kind.exp == ConstK
+          && (a->attr.op == PLUS || a->attr.op == MINUS))
+      { val = a->child[1]->attr.val;
+        if (a->attr.op == MINUS)
+          val = (int) (0u - (unsigned) val);
+        if (t->attr.op == PLUS)
+          val = (int) ((unsigned) val + (unsigned) b->attr.val);
+        else
+          val = (int) ((unsigned) val - (unsigned) b->attr.val);
+        t->attr.op = PLUS;
+        if (val < 0 && val != INT_MIN)
+        { t->attr.op = MINUS;
+          val = -val;
+        }
+        t->child[0] = a->child[0];
+        b->attr.val = val;
+        a = t->child[0];
+        simplified++;
+      }
+      if (b->attr.val == 0)
+        replace(t, a);
+      break;
+    case TIMES:
+      if (b->attr.val == 1)
+        replace(t, a);
+      else if (b->attr.val == 0 && isPure(a))
+      { makeConst(t, 0);
+        simplified++;
+      }
+      break;
+    case OVER:
+      if (b->attr.val == 1)
+        replace(t, a);
+      break;
+    default:
+      break;
+  }
+}
+
+/* Procedure foldStmts folds the statement list
+ * at link, dropping the branches of if and while
+ * statements whose conditions are constant
+ */
+static void foldStmts(TreeNode ** link)
+{ TreeNode * t, * keep;
+  while ((t = *link) != NULL)
+  { if (t->nodekind == ExpK)
+    { foldExp(t);
+      link = &t->sibling;
+      continue;
+    }
+    switch (t->kind.stmt)
+    { case IfK:
+        foldExp(t->child[0]);
+        foldStmts(&t->child[1]);
+        foldStmts(&t->child[2]);
+        if (t->child[0]->kind.exp == ConstK)
+        { keep = isConst(t->child[0], 0) ? t->child[2] : t->child[1];
+          removed++;
+          if (keep == NULL)
+          { *link = t->sibling;
+            continue;
+          }
+          keep->sibling = t->sibling;
+          *link = keep;
+          t = keep;
+        }
+        break;
+      case WhileK:
+        foldExp(t->child[0]);
+        foldStmts(&t->child[1]);
+        if (isConst(t->child[0], 0))
+        { removed++;
+          *link = t->sibling;
+          continue;
+        }
+        break;
+      case ReturnK:
+        if (t->child[0] != NULL)
+          foldExp(t->child[0]);
+        break;
+      case CompoundK:
+        foldStmts(&t->child[1]);
+        break;
+      default:
+        break;
+    }
+    link = &t->sibling;
+  }
+}
+
+/* Procedure foldConstants evaluates the constant
+ * subexpressions of the syntax tree as the TM
+ * would, applies algebraic identities and removes
+ * the branches constant conditions rule out
+ */
+void foldConstants(TreeNode * syntaxTree)
+{ TreeNode * t;
+  folded = 0;
+  simplified = 0;
+  removed = 0;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+      foldStmts(&t->child[1]);
+  if (TraceOptimize)
+    fprintf(listing, "\nFolding:\n  %d operators folded, %d simplified, "
+            "%d branches removed\n", folded, simplified, removed);
+}
@@ -0,0 +1,23 @@
+/****************************************************/
+/* File: fold.h                                     */
+/* Constant folding and algebraic simplification    */
+/* of the syntax tree for the C- compiler           */
+/****************************************************/
+
+#ifndef _FOLD_H_
+#define _FOLD_H_
+
+/* Procedure foldConstants evaluates the constant
+ * subexpressions of the syntax tree as the TM
+ * would, applies algebraic identities and removes
+ * the branches constant conditions rule out
+ */
+void foldConstants(TreeNode * syntaxTree);
+
+/* Function evaluate computes a op b the way the
+ * TM does, setting val. It returns FALSE for a
+ * division the TM would trap on
+ */
+int evaluate(TokenType op, int a, int b, int * val);
+
+#endif
@@ -71,6 +71,22 @@ typedef enum {Void,Integer} ExpType;
 
 #define MAXCHILDREN 3
 
+/* StorageClass tells where a variable lives */
+typedef enum {GlobalS,ParamS,LocalS} StorageClass;
+
+/* A Symbol is the declaration a name resolves to,
+ * shared by the declaration node and every
+ * reference to it. offset is the gp offset of a
+ * global or function, the number of a parameter,
+ * or the fp offset of a local
+ */
+typedef struct symbolRec
+   { char * name;
+     StorageClass storage;
+     int offset;
+     int size; /* words of a local, 1 for a scalar */
+   } Symbol;
+
 typedef struct treeNode
    { struct treeNode * child[MAXCHILDREN];
      struct treeNode * sibling;
@@ -82,6 +98,7 @@ typedef struct treeNode
              char * name;
              int withElse; } attr;
      ExpType type; /* for type checking of exps */
+     Symbol * sym; /* resolved by the analyzer */
    } TreeNode;
 
 /**************************************************/
@@ -116,6 +133,42 @@ extern int TraceAnalyze;
  */
 extern int TraceCode;
 
+/* TraceOptimize = TRUE causes the optimizations
+ * made on the syntax tree to be reported to the
+ * listing file
+ */
+extern int TraceOptimize;
+
+/* TraceIR = TRUE causes the IR of each function
+ * to be printed to the listing file before and
+ * after the IR passes
+ */
+extern int TraceIR;
+
+/* CodeFromIR = TRUE causes the TM code to be
+ * generated from the IR instead of straight
+ * from the syntax tree
+ */
+extern int CodeFromIR;
+
+/* ReportPasses = TRUE causes the time each pass
+ * takes and the TM instructions it saves to be
+ * reported to the listing file
+ */
+extern int ReportPasses;
+
+/* ProfileGenerate = TRUE causes the TM code to
+ * carry probes for tm to count, and tm to write
+ * a profile of the run
+ */
+extern int ProfileGenerate;
+
+/* ProfileUse = TRUE causes the profile tm wrote
+ * to guide inlining, unrolling and the layout of
+ * ifs and loops
+ */
+extern int ProfileUse;
+
 /* Error = TRUE prevents further passes if an error occurs */
 extern int Error; 
 #endif
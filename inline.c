@@ -0,0 +1,719 @@
+/****************************************************/
+/* File: inline.c                                   */
+/* Inlining of small functions for the C- compiler  */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "profile.h"
+#include "inline.h"
+
+/* A function whose body is a single return of an
+ * expression is inlined anywhere by substituting
+ * its arguments into that expression. Any other
+ * small function is inlined where its call is a
+ * whole statement, x = f(...) or return f(...):
+ * the call becomes a block whose locals take the
+ * parameters and whose statements are a copy of
+ * the body. Array parameters are replaced by the
+ * array passed, so they keep their address
+ */
+
+/* contexts a statement level call appears in */
+typedef enum {DiscardC,AssignC,ReturnC} CallContext;
+
+/* A RenameList maps a symbol of the function being
+ * inlined to what replaces it at the call site:
+ * a variable of the caller, or an expression that
+ * is copied at each use. An array reference with
+ * no index takes the kind of the array passed,
+ * IdK for an array parameter of the caller
+ */
+typedef struct renameRec
+   { Symbol * from;
+     Symbol * to;
+     ExpKind kind;
+     TreeNode * exp;
+     struct renameRec * next;
+   } * RenameList;
+
+static RenameList renames = NULL;
+
+/* the syntax tree of the program */
+static TreeNode * program;
+
+/* the function calls are being inlined into and
+   the number of nodes inlining added to it */
+static TreeNode * caller;
+static int growth;
+
+/* totals for the report */
+static int inlinedCalls;
+static int addedNodes;
+
+/* reason the last candidate was refused */
+static char * reason;
+
+/* An OutcomeList holds whether the compiler with
+ * no profile inlines each call, in the order the
+ * calls are decided, so that a decision can be
+ * told to have been changed by the profile
+ */
+typedef struct outcomeRec
+   { int lineno;
+     char * name;
+     int inlined;
+     struct outcomeRec * next;
+   } * OutcomeList;
+
+static OutcomeList outcomes = NULL;
+
+/* TRUE while the outcomes are recorded, and the
+   last recorded or the next to compare */
+static int recording = FALSE;
+static OutcomeList lastOutcome;
+
+/* Function contains returns TRUE if tree t has an
+ * expression node of the given kind
+ */
+static int contains(TreeNode * t, ExpKind kind)
+{ TreeNode * p;
+  int i;
+  if (t->nodekind == ExpK && t->kind.exp == kind)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      if (contains(p, kind))
+        return TRUE;
+  return FALSE;
+}
+
+/* Function hasReturn returns TRUE if tree t has a
+ * return statement
+ */
+static int hasReturn(TreeNode * t)
+{ TreeNode * p;
+  int i;
+  if (t->nodekind == StmtK && t->kind.stmt == ReturnK)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      if (hasReturn(p))
+        return TRUE;
+  return FALSE;
+}
+
+/* Function uses returns the number of references
+ * to the variable with symbol sym in tree t
+ */
+static int uses(TreeNode * t, Symbol * sym)
+{ TreeNode * p;
+  int i, n = 0;
+  if (t->nodekind == ExpK && t->sym == sym
+      && (t->kind.exp == IdK || t->kind.exp == IdArrayK))
+    n++;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      n += uses(p, sym);
+  return n;
+}
+
+/* Function assigns returns TRUE if tree t assigns
+ * to the variable with symbol sym
+ */
+static int assigns(TreeNode * t, Symbol * sym)
+{ TreeNode * p;
+  int i;
+  if (t->nodekind == ExpK && t->kind.exp == AssignK
+      && t->child[0]->sym == sym)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      if (assigns(p, sym))
+        return TRUE;
+  return FALSE;
+}
+
+/* Function isCall returns TRUE if t is a call of
+ * a function with a body
+ */
+static int isCall(TreeNode * t)
+{ return t != NULL && t->nodekind == ExpK && t->kind.exp == CallK
+         && t->sym != NULL;
+}
+
+/* Function isArray returns TRUE if the argument
+ * is an array passed by address
+ */
+static int isArray(TreeNode * arg)
+{ return (arg->kind.exp == IdArrayK || arg->kind.exp == IdK)
+         && arg->child[0] == NULL;
+}
+
+/* Function isCheap returns TRUE if the argument
+ * may be evaluated any number of times
+ */
+static int isCheap(TreeNode * arg)
+{ return arg->kind.exp == ConstK || arg->kind.exp == IdK
+         || (arg->kind.exp == IdArrayK && arg->child[0] == NULL);
+}
+
+/* Function isPrivate returns TRUE if the value of
+ * the argument can not be changed by the callee
+ */
+static int isPrivate(TreeNode * arg)
+{ return arg->kind.exp == ConstK
+         || (arg->kind.exp == IdK && arg->sym->storage != GlobalS)
+         || (arg->kind.exp == IdArrayK && arg->child[0] == NULL);
+}
+
+/* Function functionNode returns the declaration
+ * of the function with symbol sym
+ */
+static TreeNode * functionNode(Symbol * sym)
+{ TreeNode * t;
+  for (t = program; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK && t->sym == sym)
+      return t;
+  return NULL;
+}
+
+/* Function hasBody returns TRUE if call is to a
+ * function written in C-, not a builtin
+ */
+static int hasBody(TreeNode * call)
+{ TreeNode * f = functionNode(call->sym);
+  return f != NULL && f->child[1] != NULL;
+}
+
+/* Function candidate returns the function called
+ * by call if it is small enough to inline and
+ * does not call itself, else NULL
+ */
+static TreeNode * candidate(TreeNode * call)
+{ TreeNode * f = functionNode(call->sym);
+  int size, sizeLimit = INLINESIZE, growthLimit = INLINEGROWTH, count;
+  if (f == NULL || f->child[1] == NULL)
+  { reason = "no body";
+    return NULL;
+  }
+  if (f == caller || uses(f->child[1], f->sym) > 0)
+  { reason = "recursive";
+    return NULL;
+  }
+  size = countNodes(f->child[1]);
+  /* a hot call is inlined more freely, a cold one
+     only if that keeps the code small */
+  count = ProfileUse ? callCount(call->lineno, call->attr.name) : -1;
+  if (count >= 0 && isHot(count))
+  { sizeLimit = HOTINLINESIZE;
+    growthLimit = 2 * INLINEGROWTH;
+  }
+  else if (count >= 0)
+    sizeLimit = COLDINLINESIZE;
+  if (size > sizeLimit)
+  { reason = sizeLimit == COLDINLINESIZE ? "cold call" : "too large";
+    return NULL;
+  }
+  if (growth + size > growthLimit)
+  { reason = "caller too large";
+    return NULL;
+  }
+  return f;
+}
+
+/* Procedure addRename adds a replacement for sym */
+static void addRename(Symbol * sym, Symbol * to, TreeNode * exp)
+{ RenameList r = (RenameList) malloc(sizeof(struct renameRec));
+  r->from = sym;
+  r->to = to;
+  r->kind = IdK;
+  r->exp = exp;
+  r->next = renames;
+  renames = r;
+}
+
+/* Procedure renameArray replaces array parameter
+ * sym by the array passed as arg
+ */
+static void renameArray(Symbol * sym, TreeNode * arg)
+{ addRename(sym, arg->sym, NULL);
+  renames->kind = arg->kind.exp;
+}
+
+/* Procedure clearRenames empties the rename list */
+static void clearRenames(void)
+{ RenameList r;
+  while (renames != NULL)
+  { r = renames;
+    renames = r->next;
+    free(r);
+  }
+}
+
+/* Function newLocal returns a local of the caller
+ * standing for variable sym of function f
+ */
+static Symbol * newLocal(TreeNode * f, Symbol * sym, int size)
+{ Symbol * s = (Symbol *) malloc(sizeof(Symbol));
+  s->name = (char *) malloc(strlen(f->attr.name) + strlen(sym->name) + 2);
+  sprintf(s->name, "%s.%s", f->attr.name, sym->name);
+  s->storage = LocalS;
+  s->offset = 0;
+  s->size = size;
+  return s;
+}
+
+static TreeNode * copyList(TreeNode * t, TreeNode * f);
+
+/* Function copyNode returns a copy of tree t in
+ * which the symbols on the rename list are
+ * replaced, and each local declared is given a
+ * new symbol of the function t is copied from
+ */
+static TreeNode * copyNode(TreeNode * t, TreeNode * f)
+{ TreeNode * n;
+  RenameList r;
+  int i;
+  if (t->nodekind == ExpK && (t->kind.exp == IdK || t->kind.exp == IdArrayK))
+    for (r = renames; r != NULL; r = r->next)
+      if (r->from == t->sym && r->exp != NULL)
+        return copyNode(r->exp, f);
+  n = (TreeNode *) malloc(sizeof(TreeNode));
+  *n = *t;
+  n->sibling = NULL;
+  if (t->nodekind == ExpK)
+    switch (t->kind.exp)
+    { case IdK:
+      case IdArrayK:
+        for (r = renames; r != NULL; r = r->next)
+          if (r->from == t->sym)
+          { n->sym = r->to;
+            n->attr.name = r->to->name;
+            if (t->child[0] == NULL)
+              n->kind.exp = r->kind;
+            break;
+          }
+        break;
+      case VarK:
+      case VarArrayK:
+        n->sym = newLocal(f, t->sym, t->sym->size);
+        n->attr.name = n->sym->name;
+        addRename(t->sym, n->sym, NULL);
+        break;
+      default:
+        break;
+    }
+  for (i = 0; i < MAXCHILDREN; i++)
+  { n->child[i] = NULL;
+    if (t->child[i] != NULL)
+      n->child[i] = copyList(t->child[i], f);
+  }
+  return n;
+}
+
+/* Function copyList copies a list of trees */
+static TreeNode * copyList(TreeNode * t, TreeNode * f)
+{ TreeNode * head = NULL, ** tail = &head;
+  for (; t != NULL; t = t->sibling)
+  { *tail = copyNode(t, f);
+    tail = &(*tail)->sibling;
+  }
+  return head;
+}
+
+/* Function expandExp returns the expression of
+ * function f, whose body must be a single return,
+ * with the arguments of call substituted for its
+ * parameters, or NULL if it can not be done
+ * without changing what the call computes
+ */
+static TreeNode * expandExp(TreeNode * call, TreeNode * f)
+{ TreeNode * body = f->child[1];
+  TreeNode * e, * param, * arg, * n;
+  int effects;
+  if (body->child[0] != NULL || body->child[1] == NULL
+      || body->child[1]->sibling != NULL
+      || body->child[1]->nodekind != StmtK
+      || body->child[1]->kind.stmt != ReturnK
+      || body->child[1]->child[0] == NULL)
+  { reason = "not an expression";
+    return NULL;
+  }
+  e = body->child[1]->child[0];
+  effects = contains(e, CallK) || contains(e, AssignK);
+  reason = "arguments";
+  arg = call->child[0];
+  for (param = f->child[0]; param != NULL && param->attr.name != NULL;
+       param = param->sibling, arg = arg->sibling)
+  { if (arg == NULL || contains(arg, CallK) || contains(arg, AssignK)
+        || assigns(e, param->sym)
+        || (uses(e, param->sym) != 1 && !isCheap(arg))
+        || (effects && !isPrivate(arg))
+        || (param->kind.exp == ArrayParamK && !isArray(arg)))
+    { clearRenames();
+      return NULL;
+    }
+    if (param->kind.exp == ArrayParamK)
+      renameArray(param->sym, arg);
+    else
+      addRename(param->sym, NULL, arg);
+  }
+  n = copyNode(e, f);
+  clearRenames();
+  return n;
+}
+
+/* Function expandStmt returns a block that does
+ * what statement level call of function f does
+ * in context c, where lhs is the assigned
+ * variable, or NULL if f does not fit
+ */
+static TreeNode * expandStmt(TreeNode * call, TreeNode * f,
+                             CallContext c, TreeNode * lhs)
+{ TreeNode * body = f->child[1];
+  TreeNode * block, * decls = NULL, ** declTail = &decls;
+  TreeNode * inits = NULL, * copy, * last, ** lastLink;
+  TreeNode * param, * arg, * next, * p;
+  int sideEffects = FALSE;
+  for (last = body->child[1]; last != NULL && last->sibling != NULL; )
+    last = last->sibling;
+  if (c != ReturnC)
+  { /* returns other than the last statement need
+       a jump to the end of the block */
+    for (p = body->child[1]; p != last; p = p->sibling)
+      if (hasReturn(p))
+      { reason = "returns early";
+        return NULL;
+      }
+    if (last != NULL && hasReturn(last)
+        && (last->nodekind != StmtK || last->kind.stmt != ReturnK))
+    { reason = "returns early";
+      return NULL;
+    }
+  }
+  if (c == AssignC && (last == NULL || last->nodekind != StmtK
+                       || last->kind.stmt != ReturnK || last->child[0] == NULL))
+  { reason = "no return value";
+    return NULL;
+  }
+  arg = call->child[0];
+  for (param = f->child[0]; param != NULL && param->attr.name != NULL;
+       param = param->sibling, arg = arg->sibling)
+  { if (arg == NULL)
+    { reason = "arguments";
+      return NULL;
+    }
+    if (param->kind.exp == ArrayParamK && !isArray(arg))
+    { reason = "arguments";
+      return NULL;
+    }
+    if (contains(arg, AssignK) || contains(arg, CallK))
+      sideEffects = TRUE;
+  }
+  /* the arguments are evaluated last first, as
+     pushArguments does */
+  arg = call->child[0];
+  for (param = f->child[0]; param != NULL && param->attr.name != NULL;
+       param = param->sibling, arg = next)
+  { next = arg->sibling;
+    arg->sibling = NULL;
+    if (param->kind.exp == ArrayParamK)
+      renameArray(param->sym, arg);
+    else if (!assigns(body, param->sym)
+             && (arg->kind.exp == ConstK
+                 || (isPrivate(arg) && !sideEffects)))
+      addRename(param->sym, NULL, arg);
+    else
+    { *declTail = newExpNode(VarK);
+      (*declTail)->type = Integer;
+      (*declTail)->lineno = call->lineno;
+      (*declTail)->sym = newLocal(f, param->sym, 1);
+      (*declTail)->attr.name = (*declTail)->sym->name;
+      addRename(param->sym, (*declTail)->sym, NULL);
+      p = newExpNode(AssignK);
+      p->type = Integer;
+      p->lineno = call->lineno;
+      p->child[0] = newExpNode(IdK);
+      p->child[0]->type = Integer;
+      p->child[0]->lineno = call->lineno;
+      p->child[0]->sym = (*declTail)->sym;
+      p->child[0]->attr.name = (*declTail)->sym->name;
+      p->child[1] = arg;
+      p->sibling = inits;
+      inits = p;
+      declTail = &(*declTail)->sibling;
+    }
+  }
+  copy = copyNode(body, f);
+  clearRenames();
+  /* the copied body's final return turns into
+     what the call's context does with the value */
+  lastLink = &copy->child[1];
+  while (*lastLink != NULL && (*lastLink)->sibling != NULL)
+    lastLink = &(*lastLink)->sibling;
+  last = *lastLink;
+  if (last != NULL && last->nodekind == StmtK && last->kind.stmt == ReturnK)
+  { if (c == DiscardC)
+      *lastLink = last->child[0];
+    else if (c == AssignC)
+    { *lastLink = newExpNode(AssignK);
+      (*lastLink)->type = Integer;
+      (*lastLink)->lineno = call->lineno;
+      (*lastLink)->child[0] = lhs;
+      (*lastLink)->child[1] = last->child[0];
+    }
+  }
+  else if (c == ReturnC)
+  { p = newStmtNode(ReturnK);
+    p->lineno = call->lineno;
+    if (last == NULL)
+      copy->child[1] = p;
+    else
+      last->sibling = p;
+  }
+  block = newStmtNode(CompoundK);
+  block->lineno = call->lineno;
+  block->child[0] = decls;
+  if (inits == NULL)
+    block->child[1] = copy;
+  else
+  { block->child[1] = inits;
+    for (p = inits; p->sibling != NULL; p = p->sibling)
+      ;
+    p->sibling = copy;
+  }
+  return block;
+}
+
+/* Procedure record adds the outcome of call to
+ * the list of outcomes with no profile
+ */
+static void record(TreeNode * call, int inlined)
+{ OutcomeList o = (OutcomeList) malloc(sizeof(struct outcomeRec));
+  o->lineno = call->lineno;
+  o->name = call->attr.name;
+  o->inlined = inlined;
+  o->next = NULL;
+  if (outcomes == NULL)
+    outcomes = o;
+  else
+    lastOutcome->next = o;
+  lastOutcome = o;
+}
+
+/* Procedure clearOutcomes empties the list of
+ * outcomes
+ */
+static void clearOutcomes(void)
+{ OutcomeList o;
+  while (outcomes != NULL)
+  { o = outcomes;
+    outcomes = o->next;
+    free(o);
+  }
+}
+
+/* Procedure report lists one inlining decision,
+ * and records it if it is not the one made with
+ * no profile
+ */
+static void report(TreeNode * call, TreeNode * f)
+{ char text[128];
+  OutcomeList o = lastOutcome;
+  int count;
+  if (recording)
+  { record(call, f != NULL);
+    return;
+  }
+  if (o != NULL && o->lineno == call->lineno
+      && strcmp(o->name, call->attr.name) == 0)
+  { lastOutcome = o->next;
+    count = callCount(call->lineno, call->attr.name);
+    if (count >= 0 && o->inlined != (f != NULL))
+    { sprintf(text, "%.40s %s into %.40s, call made %d times", call->attr.name,
+              f != NULL ? "inlined" : "not inlined", caller->attr.name, count);
+      profileDecision(call->lineno, text);
+    }
+  }
+  if (!TraceOptimize)
+    return;
+  if (f != NULL)
+    fprintf(listing, "  line %d: %s inlined into %s, %d nodes\n",
+            call->lineno, call->attr.name, caller->attr.name,
+            countNodes(f->child[1]));
+  else
+    fprintf(listing, "  line %d: %s not inlined into %s: %s\n",
+            call->lineno, call->attr.name, caller->attr.name, reason);
+}
+
+/* Procedure inlined counts an inlined call */
+static void inlined(TreeNode * call, TreeNode * f)
+{ int size = countNodes(f->child[1]);
+  growth += size;
+  addedNodes += size;
+  inlinedCalls++;
+  report(call, f);
+}
+
+/* Procedure inlineExp inlines the calls within
+ * the expression at link. A call that is itself
+ * a statement is left for inlineStmt if its
+ * function is not a single expression
+ */
+static void inlineExp(TreeNode ** link, int statement)
+{ TreeNode * t = *link, * f, * n, ** p;
+  int i;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = &t->child[i]; *p != NULL; p = &(*p)->sibling)
+      inlineExp(p, statement && t->kind.exp == AssignK && i == 1);
+  if (!isCall(t))
+    return;
+  f = candidate(t);
+  if (f != NULL && (n = expandExp(t, f)) != NULL)
+  { n->sibling = t->sibling;
+    *link = n;
+    inlined(t, f);
+  }
+  else if (!statement && hasBody(t))
+    report(t, NULL);
+}
+
+/* Function isTarget returns TRUE if assigning
+ * to lhs after an inlined body is the same as
+ * assigning the value of the call to it
+ */
+static int isTarget(TreeNode * lhs)
+{ return lhs->kind.exp == IdK
+         || (lhs->kind.exp == IdArrayK && lhs->child[0] != NULL
+             && isPrivate(lhs->child[0]) && lhs->child[0]->kind.exp != IdArrayK);
+}
+
+static void inlineStmts(TreeNode ** link);
+
+/* Procedure inlineStmt inlines the calls within
+ * the statement at link
+ */
+static void inlineStmt(TreeNode ** link)
+{ TreeNode * t = *link, * call = NULL, * lhs = NULL, * f, * n = NULL;
+  CallContext c = DiscardC;
+  if (t->nodekind == StmtK)
+    switch (t->kind.stmt)
+    { case CompoundK:
+        inlineStmts(&t->child[1]);
+        break;
+      case IfK:
+        inlineExp(&t->child[0], FALSE);
+        inlineStmts(&t->child[1]);
+        inlineStmts(&t->child[2]);
+        break;
+      case WhileK:
+        inlineExp(&t->child[0], FALSE);
+        inlineStmts(&t->child[1]);
+        break;
+      case ReturnK:
+        if (t->child[0] == NULL)
+          break;
+        inlineExp(&t->child[0], TRUE);
+        if (isCall(t->child[0]))
+        { call = t->child[0];
+          c = ReturnC;
+        }
+        break;
+      default:
+        break;
+    }
+  else
+  { inlineExp(link, TRUE);
+    t = *link;
+    if (isCall(t))
+      call = t;
+    else if (t->kind.exp == AssignK && isCall(t->child[1]))
+    { if (isTarget(t->child[0]))
+      { call = t->child[1];
+        lhs = t->child[0];
+        c = AssignC;
+      }
+      else
+      { reason = "assigned to an array";
+        if (hasBody(t->child[1]))
+          report(t->child[1], NULL);
+      }
+    }
+  }
+  if (call == NULL)
+    return;
+  f = candidate(call);
+  if (f != NULL && (n = expandStmt(call, f, c, lhs)) != NULL)
+  { n->sibling = t->sibling;
+    *link = n;
+    inlined(call, f);
+  }
+  else if (hasBody(call))
+    report(call, NULL);
+}
+
+/* Procedure inlineStmts inlines the calls within
+ * a statement list
+ */
+static void inlineStmts(TreeNode ** link)
+{ for (; *link != NULL; link = &(*link)->sibling)
+    inlineStmt(link);
+}
+
+/* Procedure inlineFunctions inlines the calls in
+ * each function of program t
+ */
+static void inlineFunctions(TreeNode * t)
+{ program = t;
+  inlinedCalls = 0;
+  addedNodes = 0;
+  /* a function can only call those declared
+     before it, so callees are done first */
+  for (; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+    { caller = t;
+      growth = 0;
+      inlineStmts(&t->child[1]);
+    }
+}
+
+/* Procedure recordOutcomes inlines a copy of the
+ * functions of the syntax tree with no profile,
+ * recording what is done with each call
+ */
+static void recordOutcomes(TreeNode * syntaxTree)
+{ TreeNode * copy = NULL, ** tail = &copy, * t;
+  int trace = TraceOptimize;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK)
+    { *tail = copyNode(t, t);
+      clearRenames();
+      tail = &(*tail)->sibling;
+    }
+  clearOutcomes();
+  ProfileUse = FALSE;
+  TraceOptimize = FALSE;
+  recording = TRUE;
+  inlineFunctions(copy);
+  recording = FALSE;
+  TraceOptimize = trace;
+  ProfileUse = TRUE;
+}
+
+/* Procedure inlineCalls replaces calls to small
+ * non-recursive functions in the syntax tree by
+ * copies of their bodies
+ */
+void inlineCalls(TreeNode * syntaxTree)
+{ if (ProfileUse)
+    recordOutcomes(syntaxTree);
+  lastOutcome = outcomes;
+  if (TraceOptimize)
+    fprintf(listing, "\nInlining:\n");
+  inlineFunctions(syntaxTree);
+  if (TraceOptimize)
+    fprintf(listing, "  %d calls inlined, %d nodes added\n",
+            inlinedCalls, addedNodes);
+}
@@ -0,0 +1,31 @@
+/****************************************************/
+/* File: inline.h                                   */
+/* Inlining of small functions for the C- compiler  */
+/****************************************************/
+
+#ifndef _INLINE_H_
+#define _INLINE_H_
+
+/* INLINESIZE is the largest function body, in
+ * syntax tree nodes, that is copied into a caller
+ */
+#define INLINESIZE 40
+
+/* HOTINLINESIZE and COLDINLINESIZE replace it for
+ * a call the profile has as hot and as not hot
+ */
+#define HOTINLINESIZE 160
+#define COLDINLINESIZE 8
+
+/* INLINEGROWTH is the number of nodes inlining
+ * may add to any one function
+ */
+#define INLINEGROWTH 400
+
+/* Procedure inlineCalls replaces calls to small
+ * non-recursive functions in the syntax tree by
+ * copies of their bodies
+ */
+void inlineCalls(TreeNode * syntaxTree);
+
+#endif
@@ -0,0 +1,834 @@
+/****************************************************/
+/* File: ir.c                                       */
+/* Three-address intermediate representation for    */
+/* the C- compiler: lowering of the syntax tree to  */
+/* basic blocks over virtual registers, the control */
+/* flow graph and a textual dump                    */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "code.h"
+#include "ir.h"
+
+/* the function being lowered, the block code goes
+   to and the last block in layout order */
+static IrFunction * fn;
+static IrBlock * current;
+static IrBlock * lastBlock;
+
+/* copyReads is TRUE while lowering a statement
+   that assigns a variable inside an expression:
+   a variable read is then copied, so it keeps
+   the value it had where it was read */
+static int copyReads;
+
+/* number of the next compound statement of the
+   function being lowered */
+static int scopeCount;
+
+/* Function newBlock returns a new empty block,
+ * not yet placed in the layout
+ */
+static IrBlock * newBlock(void)
+{ IrBlock * b = (IrBlock *) malloc(sizeof(IrBlock));
+  b->id = fn->nblocks++;
+  b->first = NULL;
+  b->last = NULL;
+  b->preds = NULL;
+  b->npreds = 0;
+  b->label = 0;
+  b->next = NULL;
+  return b;
+}
+
+/* Procedure placeBlock puts block b next in the
+ * layout and directs code to it
+ */
+static void placeBlock(IrBlock * b)
+{ if (lastBlock == NULL)
+    fn->entry = b;
+  else
+    lastBlock->next = b;
+  lastBlock = b;
+  current = b;
+}
+
+/* Function newInstr returns a new instruction
+ * with opcode op and no operands
+ */
+static IrInstr * newInstr(IrOpcode op)
+{ IrInstr * i = (IrInstr *) malloc(sizeof(IrInstr));
+  i->op = op;
+  i->oper = ERROR;
+  i->dst = -1;
+  i->a.kind = IrNone;
+  i->b.kind = IrNone;
+  i->disp = 0;
+  i->sym = NULL;
+  i->args = NULL;
+  i->nargs = 0;
+  i->localArray = FALSE;
+  i->target[0] = NULL;
+  i->target[1] = NULL;
+  i->next = NULL;
+  return i;
+}
+
+/* Procedure emit appends instruction i to the
+ * current block
+ */
+static void emit(IrInstr * i)
+{ if (current->first == NULL)
+    current->first = i;
+  else
+    current->last->next = i;
+  current->last = i;
+}
+
+/* Function newReg returns a new register holding
+ * variable sym, or a temporary if sym is NULL
+ */
+static int newReg(Symbol * sym)
+{ if (fn->nregs % 16 == 0)
+    fn->vregSym = (Symbol **) realloc(fn->vregSym,
+                                      (fn->nregs + 16) * sizeof(Symbol *));
+  fn->vregSym[fn->nregs] = sym;
+  return fn->nregs++;
+}
+
+/* Function regOf returns the register holding
+ * the local or parameter sym
+ */
+static int regOf(Symbol * sym)
+{ int r;
+  for (r = fn->nregs - 1; r >= 0; r--)
+    if (fn->vregSym[r] == sym)
+      return r;
+  return -1;
+}
+
+/* Function reg returns register r as a value */
+static IrValue reg(int r)
+{ IrValue v;
+  v.kind = IrReg;
+  v.val = r;
+  return v;
+}
+
+/* Function imm returns constant c as a value */
+static IrValue imm(int c)
+{ IrValue v;
+  v.kind = IrImm;
+  v.val = c;
+  return v;
+}
+
+/* Function binary emits dst = a oper b into a new
+ * temporary and returns it
+ */
+static IrValue binary(TokenType oper, IrValue a, IrValue b)
+{ IrInstr * i = newInstr(IrBinary);
+  i->oper = oper;
+  i->a = a;
+  i->b = b;
+  i->dst = newReg(NULL);
+  emit(i);
+  return reg(i->dst);
+}
+
+/* Procedure jump ends the current block with a
+ * jump to block b
+ */
+static void jump(IrBlock * b)
+{ IrInstr * i = newInstr(IrJump);
+  i->target[0] = b;
+  emit(i);
+}
+
+/* Function isVariable returns TRUE if v is a
+ * register holding a variable
+ */
+static int isVariable(IrValue v)
+{ return v.kind == IrReg && fn->vregSym[v.val] != NULL;
+}
+
+/* Function assignments returns the number of
+ * assignments in tree t, siblings excluded
+ */
+static int assignments(TreeNode * t)
+{ TreeNode * p;
+  int i, n = 0;
+  if (t == NULL)
+    return 0;
+  if (t->nodekind == ExpK && t->kind.exp == AssignK)
+    n++;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      n += assignments(p);
+  return n;
+}
+
+static IrValue lowerExp(TreeNode * t);
+
+/* Procedure lowerElement computes the address of
+ * the array element t as base + disp, where an
+ * absent base is the bottom of memory
+ */
+static void lowerElement(TreeNode * t, IrValue * base, int * disp)
+{ TreeNode * index = t->child[0];
+  IrValue v, a;
+  IrInstr * i;
+  int k = 0;
+  /* a constant added to the index goes into the
+     displacement */
+  if (index->kind.exp == OpK
+      && (index->attr.op == PLUS || index->attr.op == MINUS)
+      && index->child[1]->kind.exp == ConstK)
+  { k = index->attr.op == PLUS ? index->child[1]->attr.val
+                               : -index->child[1]->attr.val;
+    index = index->child[0];
+  }
+  v = lowerExp(index);
+  switch (t->sym->storage)
+  { case GlobalS:
+      a.kind = IrNone;
+      k += t->sym->offset;
+      break;
+    case ParamS:
+      a = reg(regOf(t->sym));
+      break;
+    default:
+      i = newInstr(IrAddress);
+      i->sym = t->sym;
+      i->dst = newReg(NULL);
+      emit(i);
+      a = reg(i->dst);
+      break;
+  }
+  if (v.kind == IrImm)
+  { *base = a;
+    *disp = k + v.val;
+  }
+  else if (a.kind == IrNone)
+  { *base = v;
+    *disp = k;
+  }
+  else
+  { *base = binary(PLUS, a, v);
+    *disp = k;
+  }
+}
+
+/* Function lowerCall emits call t and returns
+ * its value, if wanted
+ */
+static IrValue lowerCall(TreeNode * t, int wanted)
+{ TreeNode * p, ** arg;
+  IrInstr * i = newInstr(IrCall);
+  int n;
+  i->sym = t->sym;
+  i->localArray = passesLocalArray(t);
+  for (p = t->child[0]; p != NULL; p = p->sibling)
+    i->nargs++;
+  i->args = (IrValue *) malloc((i->nargs + 1) * sizeof(IrValue));
+  arg = (TreeNode **) malloc((i->nargs + 1) * sizeof(TreeNode *));
+  for (p = t->child[0], n = 0; p != NULL; p = p->sibling)
+    arg[n++] = p;
+  /* the arguments are evaluated last first, as
+     cgen pushes them */
+  for (n = i->nargs - 1; n >= 0; n--)
+    i->args[n] = lowerExp(arg[n]);
+  free(arg);
+  if (wanted)
+    i->dst = newReg(NULL);
+  emit(i);
+  return wanted ? reg(i->dst) : imm(0);
+}
+
+/* Function lowerAssign emits assignment t and
+ * returns the value assigned
+ */
+static IrValue lowerAssign(TreeNode * t)
+{ TreeNode * lhs = t->child[0];
+  IrValue v, base;
+  IrInstr * i;
+  int r, disp;
+  v = lowerExp(t->child[1]);
+  if (lhs->kind.exp == IdK && lhs->sym->storage != GlobalS)
+  { r = regOf(lhs->sym);
+    if (v.kind == IrReg && !isVariable(v) && current->last != NULL
+        && current->last->dst == v.val)
+      /* compute the value straight into the
+         variable */
+      current->last->dst = r;
+    else
+    { i = newInstr(IrCopy);
+      i->dst = r;
+      i->a = v;
+      emit(i);
+    }
+    v = reg(r);
+    if (copyReads)
+    { i = newInstr(IrCopy);
+      i->dst = newReg(NULL);
+      i->a = v;
+      emit(i);
+      v = reg(i->dst);
+    }
+    return v;
+  }
+  if (lhs->kind.exp == IdK)
+  { base.kind = IrNone;
+    disp = lhs->sym->offset;
+  }
+  else
+    lowerElement(lhs, &base, &disp);
+  i = newInstr(IrStore);
+  i->sym = lhs->sym;
+  i->a = base;
+  i->disp = disp;
+  i->b = v;
+  emit(i);
+  return v;
+}
+
+/* Function lowerExp emits expression t and
+ * returns its value
+ */
+static IrValue lowerExp(TreeNode * t)
+{ IrInstr * i;
+  IrValue a, b;
+  int disp;
+  switch (t->kind.exp)
+  { case ConstK:
+      return imm(t->attr.val);
+    case IdK:
+      if (t->sym->storage == GlobalS)
+      { i = newInstr(IrLoad);
+        i->sym = t->sym;
+        i->disp = t->sym->offset;
+        i->dst = newReg(NULL);
+        emit(i);
+        return reg(i->dst);
+      }
+      a = reg(regOf(t->sym));
+      if (copyReads)
+      { i = newInstr(IrCopy);
+        i->a = a;
+        i->dst = newReg(NULL);
+        emit(i);
+        a = reg(i->dst);
+      }
+      return a;
+    case IdArrayK:
+      if (t->child[0] == NULL)
+      { /* the address of the array */
+        if (t->sym->storage == ParamS)
+          return reg(regOf(t->sym));
+        i = newInstr(IrAddress);
+        i->sym = t->sym;
+        i->dst = newReg(NULL);
+        emit(i);
+        return reg(i->dst);
+      }
+      lowerElement(t, &a, &disp);
+      i = newInstr(IrLoad);
+      i->sym = t->sym;
+      i->a = a;
+      i->disp = disp;
+      i->dst = newReg(NULL);
+      emit(i);
+      return reg(i->dst);
+    case OpK:
+      a = lowerExp(t->child[0]);
+      b = lowerExp(t->child[1]);
+      return binary(t->attr.op, a, b);
+    case CallK:
+      return lowerCall(t, TRUE);
+    case AssignK:
+      return lowerAssign(t);
+    default:
+      return imm(0);
+  }
+}
+
+/* Procedure lowerCond ends the current block with
+ * a branch on test t to block yes or block no
+ */
+static void lowerCond(TreeNode * t, IrBlock * yes, IrBlock * no)
+{ IrInstr * i = newInstr(IrBranch);
+  copyReads = assignments(t) > 0;
+  if (t->kind.exp == OpK && isRelation(t->attr.op))
+  { i->a = lowerExp(t->child[0]);
+    i->b = lowerExp(t->child[1]);
+    i->oper = t->attr.op;
+  }
+  else
+  { i->a = lowerExp(t);
+    i->b = imm(0);
+    i->oper = NE;
+  }
+  i->target[0] = yes;
+  i->target[1] = no;
+  emit(i);
+}
+
+/* Procedure lowerStmts emits a statement list */
+static void lowerStmts(TreeNode * t)
+{ IrBlock * yes, * no, * end, * test;
+  IrInstr * i;
+  TreeNode * p;
+  int k, n;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK)
+    { copyReads = assignments(t) > (t->kind.exp == AssignK);
+      if (t->kind.exp == CallK)
+        lowerCall(t, FALSE);
+      else
+        lowerExp(t);
+      continue;
+    }
+    switch (t->kind.stmt)
+    { case IfK:
+        yes = newBlock();
+        end = newBlock();
+        no = t->child[2] != NULL ? newBlock() : end;
+        lowerCond(t->child[0], yes, no);
+        placeBlock(yes);
+        lowerStmts(t->child[1]);
+        jump(end);
+        if (t->child[2] != NULL)
+        { placeBlock(no);
+          lowerStmts(t->child[2]);
+          jump(end);
+        }
+        placeBlock(end);
+        break;
+      case WhileK:
+        /* the test goes after the body, as cgen
+           places it */
+        yes = newBlock();
+        test = newBlock();
+        end = newBlock();
+        jump(test);
+        placeBlock(yes);
+        lowerStmts(t->child[1]);
+        jump(test);
+        placeBlock(test);
+        lowerCond(t->child[0], yes, end);
+        placeBlock(end);
+        break;
+      case ReturnK:
+        i = newInstr(IrReturn);
+        if (t->child[0] != NULL)
+        { copyReads = assignments(t->child[0]) > 0;
+          i->a = lowerExp(t->child[0]);
+        }
+        emit(i);
+        /* anything after it is unreachable */
+        placeBlock(newBlock());
+        break;
+      case CompoundK:
+        n = fn->narrays;
+        for (p = t->child[0]; p != NULL; p = p->sibling)
+          if (p->kind.exp == VarArrayK)
+          { fn->arrays = (Symbol **) realloc(fn->arrays,
+                             (fn->narrays + 1) * sizeof(Symbol *));
+            fn->scopeFirst = (int *) realloc(fn->scopeFirst,
+                                 (fn->narrays + 1) * sizeof(int));
+            fn->scopeLast = (int *) realloc(fn->scopeLast,
+                                (fn->narrays + 1) * sizeof(int));
+            fn->scopeFirst[fn->narrays] = scopeCount;
+            fn->arrays[fn->narrays++] = p->sym;
+          }
+          else
+            newReg(p->sym);
+        scopeCount++;
+        lowerStmts(t->child[1]);
+        for (k = n; k < fn->narrays; k++)
+          fn->scopeLast[k] = scopeCount - 1;
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+/* Function lowerFunction returns function t in IR */
+static IrFunction * lowerFunction(TreeNode * t)
+{ TreeNode * p;
+  IrInstr * i;
+  fn = (IrFunction *) malloc(sizeof(IrFunction));
+  fn->name = t->attr.name;
+  fn->sym = t->sym;
+  fn->nparams = 0;
+  fn->nregs = 0;
+  fn->vregSym = NULL;
+  fn->arrays = NULL;
+  fn->scopeFirst = NULL;
+  fn->scopeLast = NULL;
+  fn->narrays = 0;
+  scopeCount = 0;
+  fn->entry = NULL;
+  fn->nblocks = 0;
+  fn->next = NULL;
+  for (p = t->child[0]; p != NULL; p = p->sibling)
+    if (p->attr.name != NULL)
+    { newReg(p->sym);
+      fn->nparams++;
+    }
+  if (t->child[1] == NULL)
+    return fn;
+  lastBlock = NULL;
+  placeBlock(newBlock());
+  lowerStmts(t->child[1]);
+  /* falling off the end returns */
+  i = newInstr(IrReturn);
+  emit(i);
+  buildCfg(fn);
+  return fn;
+}
+
+/* Function lowerProgram translates the functions
+ * of the syntax tree into IR, builtins included
+ * with no blocks, and returns them in order
+ */
+IrFunction * lowerProgram(TreeNode * syntaxTree)
+{ IrFunction * first = NULL, * last = NULL, * f;
+  TreeNode * t;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK)
+    { f = lowerFunction(t);
+      if (last == NULL)
+        first = f;
+      else
+        last->next = f;
+      last = f;
+    }
+  return first;
+}
+
+/* Function isTerminator returns TRUE if op ends
+ * a block
+ */
+int isTerminator(IrOpcode op)
+{ return op == IrJump || op == IrBranch || op == IrReturn;
+}
+
+/* Function successors stores in succ the blocks
+ * control may go to from block b and returns
+ * their number
+ */
+int successors(IrBlock * b, IrBlock ** succ)
+{ IrInstr * i = b->last;
+  if (i == NULL)
+    return 0;
+  switch (i->op)
+  { case IrJump:
+      succ[0] = i->target[0];
+      return 1;
+    case IrBranch:
+      succ[0] = i->target[0];
+      succ[1] = i->target[1];
+      return succ[0] == succ[1] ? 1 : 2;
+    default:
+      return 0;
+  }
+}
+
+/* Procedure buildCfg numbers the blocks of
+ * function f and records their predecessors
+ */
+void buildCfg(IrFunction * f)
+{ IrBlock * b, * succ[2];
+  int n, k;
+  n = 0;
+  for (b = f->entry; b != NULL; b = b->next)
+  { b->id = n++;
+    b->npreds = 0;
+    free(b->preds);
+    b->preds = NULL;
+  }
+  f->nblocks = n;
+  for (b = f->entry; b != NULL; b = b->next)
+    for (k = successors(b, succ) - 1; k >= 0; k--)
+    { succ[k]->preds = (IrBlock **) realloc(succ[k]->preds,
+                            (succ[k]->npreds + 1) * sizeof(IrBlock *));
+      succ[k]->preds[succ[k]->npreds++] = b;
+    }
+}
+
+/* Function definesReg returns the register
+ * instruction i defines, or -1
+ */
+int definesReg(IrInstr * i)
+{ switch (i->op)
+  { case IrCopy:
+    case IrBinary:
+    case IrAddress:
+    case IrLoad:
+    case IrCall:
+      return i->dst;
+    default:
+      return -1;
+  }
+}
+
+/* Function usedValues stores in uses the operands
+ * instruction i reads and returns their number;
+ * uses must have room for 2 + i->nargs of them
+ */
+int usedValues(IrInstr * i, IrValue ** uses)
+{ int n = 0, k;
+  if (i->op == IrCall)
+  { for (k = 0; k < i->nargs; k++)
+      uses[n++] = &i->args[k];
+    return n;
+  }
+  if (i->a.kind != IrNone)
+    uses[n++] = &i->a;
+  if (i->b.kind != IrNone)
+    uses[n++] = &i->b;
+  return n;
+}
+
+/* Procedure liveBefore updates live, the registers
+ * live after instruction i, to those live before it
+ */
+void liveBefore(IrInstr * i, char * live)
+{ IrValue * uses[2 + 64], ** use = uses;
+  int n, d;
+  d = definesReg(i);
+  if (d >= 0)
+    live[d] = FALSE;
+  if (i->nargs > 64)
+    use = (IrValue **) malloc((2 + i->nargs) * sizeof(IrValue *));
+  for (n = usedValues(i, use) - 1; n >= 0; n--)
+    if (use[n]->kind == IrReg)
+      live[use[n]->val] = TRUE;
+  if (use != uses)
+    free(use);
+}
+
+/* Procedure liveOut sets live to the registers of
+ * function f live at the end of block b, from
+ * liveIn, those live at each block's entry
+ */
+void liveOut(IrFunction * f, IrBlock * b, char ** liveIn, char * live)
+{ IrBlock * succ[2];
+  int k, r;
+  memset(live, 0, f->nregs);
+  for (k = successors(b, succ) - 1; k >= 0; k--)
+    for (r = 0; r < f->nregs; r++)
+      live[r] |= liveIn[succ[k]->id][r];
+}
+
+/* Function blockInstrs stores in instrs the
+ * instructions of block b in order and returns
+ * their number; instrs must have room for them
+ */
+int blockInstrs(IrBlock * b, IrInstr ** instrs)
+{ IrInstr * i;
+  int n = 0;
+  for (i = b->first; i != NULL; i = i->next)
+    instrs[n++] = i;
+  return n;
+}
+
+/* Function longestBlock returns the number of
+ * instructions of the longest block of f
+ */
+int longestBlock(IrFunction * f)
+{ IrBlock * b;
+  IrInstr * i;
+  int k, m = 0;
+  for (b = f->entry; b != NULL; b = b->next)
+  { for (k = 0, i = b->first; i != NULL; i = i->next)
+      k++;
+    if (k > m)
+      m = k;
+  }
+  return m;
+}
+
+/* Function liveness returns the registers of
+ * function f live at each block's entry, indexed
+ * by block number, iterating over the graph until
+ * nothing changes
+ */
+char ** liveness(IrFunction * f)
+{ IrBlock * b, ** order;
+  IrInstr ** instrs;
+  char ** liveIn, * live;
+  int n, k, changed = TRUE;
+  liveIn = (char **) malloc(f->nblocks * sizeof(char *));
+  order = (IrBlock **) malloc(f->nblocks * sizeof(IrBlock *));
+  for (b = f->entry, n = 0; b != NULL; b = b->next, n++)
+  { liveIn[b->id] = (char *) calloc(f->nregs, 1);
+    order[n] = b;
+  }
+  live = (char *) malloc(f->nregs);
+  instrs = (IrInstr **) malloc((longestBlock(f) + 1) * sizeof(IrInstr *));
+  while (changed)
+  { changed = FALSE;
+    /* blocks in reverse layout order, so most
+       successors are done first */
+    for (n = f->nblocks - 1; n >= 0; n--)
+    { b = order[n];
+      liveOut(f, b, liveIn, live);
+      k = blockInstrs(b, instrs);
+      while (--k >= 0)
+        liveBefore(instrs[k], live);
+      if (memcmp(live, liveIn[b->id], f->nregs) != 0)
+      { memcpy(liveIn[b->id], live, f->nregs);
+        changed = TRUE;
+      }
+    }
+  }
+  free(order);
+  free(live);
+  free(instrs);
+  return liveIn;
+}
+
+/* Procedure freeLiveness frees liveIn, as
+ * liveness returned it for function f
+ */
+void freeLiveness(IrFunction * f, char ** liveIn)
+{ int n;
+  for (n = 0; n < f->nblocks; n++)
+    free(liveIn[n]);
+  free(liveIn);
+}
+
+/* Function operName returns the C- spelling of
+ * operator op
+ */
+static char * operName(TokenType op)
+{ switch (op)
+  { case PLUS: return "+";
+    case MINUS: return "-";
+    case TIMES: return "*";
+    case OVER: return "/";
+    case LT: return "<";
+    case LE: return "<=";
+    case GT: return ">";
+    case GE: return ">=";
+    case EQ: return "==";
+    case NE: return "!=";
+    default: return "?";
+  }
+}
+
+/* Procedure printValue prints operand v */
+static void printValue(IrValue v)
+{ if (v.kind == IrReg)
+    fprintf(listing, "v%d", v.val);
+  else
+    fprintf(listing, "%d", v.val);
+}
+
+/* Procedure printAddress prints the address of a
+ * load or store
+ */
+static void printAddress(IrInstr * i)
+{ fprintf(listing, "mem[");
+  if (i->a.kind != IrNone)
+  { printValue(i->a);
+    if (i->disp != 0)
+      fprintf(listing, "%+d", i->disp);
+  }
+  else
+    fprintf(listing, "%d", i->disp);
+  fprintf(listing, "]");
+}
+
+/* Procedure dumpIr prints function f in textual
+ * form to the listing file
+ */
+void dumpIr(IrFunction * f)
+{ IrBlock * b;
+  IrInstr * i;
+  int r, k;
+  fprintf(listing, "\nfunction %s(", f->name);
+  for (r = 0; r < f->nparams; r++)
+    fprintf(listing, "%sv%d %s", r > 0 ? ", " : "", r, f->vregSym[r]->name);
+  fprintf(listing, ")\n");
+  if (f->entry == NULL)
+    return;
+  for (r = f->nparams; r < f->nregs; r++)
+    if (f->vregSym[r] != NULL)
+      fprintf(listing, "  var v%d %s\n", r, f->vregSym[r]->name);
+  for (k = 0; k < f->narrays; k++)
+    fprintf(listing, "  array %s[%d]\n", f->arrays[k]->name,
+            f->arrays[k]->size);
+  for (b = f->entry; b != NULL; b = b->next)
+  { fprintf(listing, "B%d:", b->id);
+    if (b->npreds > 0)
+    { fprintf(listing, "%*spreds", 8 - (b->id > 9 ? 4 : 3), "");
+      for (k = 0; k < b->npreds; k++)
+        fprintf(listing, " B%d", b->preds[k]->id);
+    }
+    fprintf(listing, "\n");
+    for (i = b->first; i != NULL; i = i->next)
+    { fprintf(listing, "  ");
+      switch (i->op)
+      { case IrCopy:
+          fprintf(listing, "v%d = ", i->dst);
+          printValue(i->a);
+          break;
+        case IrBinary:
+          fprintf(listing, "v%d = ", i->dst);
+          printValue(i->a);
+          fprintf(listing, " %s ", operName(i->oper));
+          printValue(i->b);
+          break;
+        case IrAddress:
+          fprintf(listing, "v%d = &%s", i->dst, i->sym->name);
+          break;
+        case IrLoad:
+          fprintf(listing, "v%d = ", i->dst);
+          printAddress(i);
+          fprintf(listing, "   ; %s", i->sym->name);
+          break;
+        case IrStore:
+          printAddress(i);
+          fprintf(listing, " = ");
+          printValue(i->b);
+          fprintf(listing, "   ; %s", i->sym->name);
+          break;
+        case IrCall:
+          if (i->dst >= 0)
+            fprintf(listing, "v%d = ", i->dst);
+          fprintf(listing, "call %s(", i->sym->name);
+          for (k = 0; k < i->nargs; k++)
+          { if (k > 0)
+              fprintf(listing, ", ");
+            printValue(i->args[k]);
+          }
+          fprintf(listing, ")");
+          break;
+        case IrJump:
+          fprintf(listing, "goto B%d", i->target[0]->id);
+          break;
+        case IrBranch:
+          fprintf(listing, "if ");
+          printValue(i->a);
+          fprintf(listing, " %s ", operName(i->oper));
+          printValue(i->b);
+          fprintf(listing, " goto B%d else B%d", i->target[0]->id,
+                  i->target[1]->id);
+          break;
+        case IrReturn:
+          fprintf(listing, "return");
+          if (i->a.kind != IrNone)
+          { fprintf(listing, " ");
+            printValue(i->a);
+          }
+          break;
+      }
+      fprintf(listing, "\n");
+    }
+  }
+}
@@ -0,0 +1,156 @@
+/****************************************************/
+/* File: ir.h                                       */
+/* Three-address intermediate representation for    */
+/* the C- compiler: each function is a control-flow */
+/* graph of basic blocks over virtual registers     */
+/****************************************************/
+
+#ifndef _IR_H_
+#define _IR_H_
+
+/* IrOpcode is the operation of an instruction:
+ *   IrCopy     dst = a
+ *   IrBinary   dst = a oper b
+ *   IrAddress  dst = &sym, the address of an array
+ *   IrLoad     dst = mem[a + disp]
+ *   IrStore    mem[a + disp] = b
+ *   IrCall     dst = sym(args)
+ *   IrJump     goto target[0]
+ *   IrBranch   if a oper b goto target[0]
+ *              else goto target[1]
+ *   IrReturn   return a
+ * The last three end a block and appear nowhere else
+ */
+typedef enum {IrCopy,IrBinary,IrAddress,IrLoad,IrStore,IrCall,
+              IrJump,IrBranch,IrReturn} IrOpcode;
+
+/* IrValueKind tells what an operand is: nothing,
+ * a virtual register or an immediate constant
+ */
+typedef enum {IrNone,IrReg,IrImm} IrValueKind;
+
+typedef struct
+   { IrValueKind kind;
+     int val; /* register number or constant */
+   } IrValue;
+
+typedef struct irInstr
+   { IrOpcode op;
+     TokenType oper; /* of IrBinary and IrBranch */
+     int dst; /* register defined, or -1 */
+     IrValue a, b;
+     int disp; /* of IrLoad and IrStore */
+     Symbol * sym; /* array, global or function */
+     IrValue * args; /* of IrCall, first argument first */
+     int nargs;
+     int localArray; /* of IrCall: passes a local array */
+     struct irBlock * target[2];
+     struct irInstr * next;
+   } IrInstr;
+
+typedef struct irBlock
+   { int id;
+     IrInstr * first, * last; /* last ends the block */
+     struct irBlock ** preds;
+     int npreds;
+     int label; /* for the code generators */
+     struct irBlock * next; /* in layout order */
+   } IrBlock;
+
+/* An IrFunction holds the blocks of a function in
+ * layout order, entry first. Registers below
+ * nparams hold the parameters; vregSym names the
+ * variable a register holds, or is NULL for a
+ * temporary. arrays lists the local arrays, each
+ * declared in a compound statement whose number
+ * is its scopeFirst, and whose nested ones end
+ * with its scopeLast: arrays whose ranges are
+ * disjoint are never live together
+ */
+typedef struct irFunction
+   { char * name;
+     Symbol * sym;
+     int nparams;
+     int nregs;
+     Symbol ** vregSym;
+     Symbol ** arrays;
+     int * scopeFirst, * scopeLast;
+     int narrays;
+     IrBlock * entry;
+     int nblocks;
+     struct irFunction * next;
+   } IrFunction;
+
+/* Function lowerProgram translates the functions
+ * of the syntax tree into IR, builtins included
+ * with no blocks, and returns them in order
+ */
+IrFunction * lowerProgram(TreeNode * syntaxTree);
+
+/* Function successors stores in succ the blocks
+ * control may go to from block b and returns
+ * their number
+ */
+int successors(IrBlock * b, IrBlock ** succ);
+
+/* Procedure buildCfg numbers the blocks of
+ * function f and records their predecessors
+ */
+void buildCfg(IrFunction * f);
+
+/* Function isTerminator returns TRUE if op ends
+ * a block
+ */
+int isTerminator(IrOpcode op);
+
+/* Function definesReg returns the register
+ * instruction i defines, or -1
+ */
+int definesReg(IrInstr * i);
+
+/* Function usedValues stores in uses the operands
+ * instruction i reads and returns their number;
+ * uses must have room for 2 + i->nargs of them
+ */
+int usedValues(IrInstr * i, IrValue ** uses);
+
+/* Procedure liveBefore updates live, the registers
+ * live after instruction i, to those live before it
+ */
+void liveBefore(IrInstr * i, char * live);
+
+/* Procedure liveOut sets live to the registers of
+ * function f live at the end of block b, from
+ * liveIn, those live at each block's entry
+ */
+void liveOut(IrFunction * f, IrBlock * b, char ** liveIn, char * live);
+
+/* Function blockInstrs stores in instrs the
+ * instructions of block b in order and returns
+ * their number; instrs must have room for them
+ */
+int blockInstrs(IrBlock * b, IrInstr ** instrs);
+
+/* Function longestBlock returns the number of
+ * instructions of the longest block of f
+ */
+int longestBlock(IrFunction * f);
+
+/* Function liveness returns the registers of
+ * function f live at each block's entry, indexed
+ * by block number, iterating over the graph until
+ * nothing changes
+ */
+char ** liveness(IrFunction * f);
+
+/* Procedure freeLiveness frees liveIn, as
+ * liveness returned it for function f
+ */
+void freeLiveness(IrFunction * f, char ** liveIn);
+
+/* Procedure dumpIr prints function f in textual
+ * form to the listing file
+ */
+void dumpIr(IrFunction * f);
+
+#endif
@@ -0,0 +1,391 @@
+/****************************************************/
+/* File: irgen.c                                    */
+/* TM code generation from the IR for the C-        */
+/* compiler. Each virtual register has a home word  */
+/* in the frame: a parameter its argument slot,     */
+/* any other register a slot below fp, shared with  */
+/* the registers never live at the same time, and   */
+/* local arrays of disjoint blocks share words too. */
+/* Operands are loaded into ac and ac1 and results  */
+/* stored back                                      */
+/****************************************************/
+
+#include "globals.h"
+#include "code.h"
+#include "ir.h"
+#include "optimize.h"
+#include "irgen.h"
+
+/* the function being generated, and the home
+   fp offset of each of its registers */
+static IrFunction * fn;
+static int * home;
+
+/* functionLabel holds the label of each function,
+   indexed by its global location */
+static int * functionLabel = NULL;
+
+/* Function jumpOp returns the TM jump taken when
+ * a - b satisfies relation op, or its inverse if
+ * sense is FALSE
+ */
+static TmOp jumpOp(TokenType op, int sense)
+{ if (!sense)
+    switch (op)
+    { case LT: op = GE; break;
+      case LE: op = GT; break;
+      case GT: op = LE; break;
+      case GE: op = LT; break;
+      case EQ: op = NE; break;
+      default: op = EQ; break;
+    }
+  switch (op)
+  { case LT: return opJLT;
+    case LE: return opJLE;
+    case GT: return opJGT;
+    case GE: return opJGE;
+    case EQ: return opJEQ;
+    default: return opJNE;
+  }
+}
+
+/* Procedure load puts value v in register r */
+static void load(IrValue v, int r)
+{ if (v.kind == IrImm)
+    emitRM(opLDC, r, v.val, 0, "load const");
+  else
+    emitRM(opLD, r, home[v.val], fp, "load register");
+}
+
+/* Procedure store saves register r in the home
+ * of virtual register dst
+ */
+static void store(int r, int dst)
+{ emitRM(opST, r, home[dst], fp, "store register");
+}
+
+/* Procedure genDifference leaves a - b in ac, or
+ * just a when b is 0
+ */
+static void genDifference(IrValue a, IrValue b)
+{ load(a, ac);
+  if (b.kind == IrImm)
+  { if (b.val != 0)
+      emitRM(opLDA, ac, -b.val, ac, "subtract const");
+  }
+  else
+  { load(b, ac1);
+    emitRO(opSUB, ac, ac, ac1, "compare");
+  }
+}
+
+/* Procedure genBinary generates dst = a oper b */
+static void genBinary(IrInstr * i)
+{ switch (i->oper)
+  { case PLUS:
+    case MINUS:
+      load(i->a, ac);
+      if (i->b.kind == IrImm)
+        emitRM(opLDA, ac, i->oper == PLUS ? i->b.val : -i->b.val, ac,
+               "op +/- const");
+      else
+      { load(i->b, ac1);
+        emitRO(i->oper == PLUS ? opADD : opSUB, ac, ac, ac1, "op +/-");
+      }
+      break;
+    case TIMES:
+    case OVER:
+      load(i->a, ac);
+      load(i->b, ac1);
+      emitRO(i->oper == TIMES ? opMUL : opDIV, ac, ac, ac1, "op * or /");
+      break;
+    default:
+      /* a comparison as a value: 1 if it holds */
+      genDifference(i->a, i->b);
+      emitRM(jumpOp(i->oper, TRUE), ac, 2, pc, "skip if true");
+      emitRM(opLDC, ac, 0, 0, "false");
+      emitRM(opLDA, pc, 1, pc, "skip true");
+      emitRM(opLDC, ac, 1, 0, "true");
+      break;
+  }
+  store(ac, i->dst);
+}
+
+/* Function genBase loads the base of load or
+ * store i into register r and returns r, or gp
+ * if the address is absolute
+ */
+static int genBase(IrInstr * i, int r)
+{ if (i->a.kind == IrNone)
+    return gp;
+  load(i->a, r);
+  return r;
+}
+
+/* Procedure genCall generates a call, pushing
+ * the arguments last first below mp
+ */
+static void genCall(IrInstr * i)
+{ int k;
+  char comment[128];
+  if (TraceCode)
+  { sprintf(comment, "-> call function %s", i->sym->name);
+    emitComment(comment);
+  }
+  for (k = i->nargs - 1; k >= 0; k--)
+  { load(i->args[k], ac);
+    emitRM(opST, ac, k - i->nargs, mp, "push argument");
+  }
+  if (i->nargs > 0)
+    emitRM(opLDA, mp, -i->nargs, mp, "stack growth after push arguments");
+  emitJump(opCALL, mp, functionLabel[i->sym->offset],
+           "push return address and jump");
+  if (i->dst >= 0)
+    store(ac, i->dst);
+}
+
+/* Function isTailCall returns TRUE if tail calls
+ * are enabled and call i is followed by the return
+ * of its value and passes no array of the frame
+ * it would reuse
+ */
+static int isTailCall(IrInstr * i)
+{ IrInstr * r = i->next;
+  return passEnabled("tail-calls") && r != NULL && r->op == IrReturn && i->dst >= 0
+         && r->a.kind == IrReg && r->a.val == i->dst
+         && !i->localArray;
+}
+
+/* Procedure genTailCall generates call i, whose
+ * value is returned, as a jump reusing the frame:
+ * the arguments are pushed below mp and then
+ * copied into place
+ */
+static void genTailCall(IrInstr * i)
+{ int k, n = i->nargs;
+  char comment[128];
+  if (TraceCode)
+  { sprintf(comment, "-> tail call function %s", i->sym->name);
+    emitComment(comment);
+  }
+  for (k = n - 1; k >= 0; k--)
+  { load(i->args[k], ac);
+    emitRM(opST, ac, k - n, mp, "push argument");
+  }
+  emitTailArguments(fn->nparams, n, -n);
+  emitTailFrame(fn->nparams, n);
+  emitGoto(functionLabel[i->sym->offset], "tail call: jump to function");
+}
+
+/* Procedure genInstr generates instruction i of
+ * block b
+ */
+static void genInstr(IrBlock * b, IrInstr * i)
+{ int base;
+  switch (i->op)
+  { case IrCopy:
+      load(i->a, ac);
+      store(ac, i->dst);
+      break;
+    case IrBinary:
+      genBinary(i);
+      break;
+    case IrAddress:
+      if (i->sym->storage == GlobalS)
+        emitRM(opLDC, ac, i->sym->offset, 0, "global array address");
+      else
+        emitRM(opLDA, ac, i->sym->offset, fp, "local array address");
+      store(ac, i->dst);
+      break;
+    case IrLoad:
+      base = genBase(i, ac1);
+      emitRM(opLD, ac, i->disp, base, "load memory");
+      store(ac, i->dst);
+      break;
+    case IrStore:
+      load(i->b, ac);
+      base = genBase(i, ac1);
+      emitRM(opST, ac, i->disp, base, "store memory");
+      break;
+    case IrCall:
+      genCall(i);
+      break;
+    case IrJump:
+      emitGoto(i->target[0]->label, "jump");
+      break;
+    case IrBranch:
+      genDifference(i->a, i->b);
+      if (i->target[0] == b->next)
+        emitJump(jumpOp(i->oper, FALSE), ac, i->target[1]->label,
+                 "branch if false");
+      else
+      { emitJump(jumpOp(i->oper, TRUE), ac, i->target[0]->label,
+                 "branch if true");
+        emitGoto(i->target[1]->label, "jump");
+      }
+      break;
+    case IrReturn:
+      if (i->a.kind != IrNone)
+        load(i->a, ac);
+      emitReturn(fn->nparams);
+      break;
+  }
+}
+
+/* Function arraysConflict returns TRUE if local
+ * arrays j and k of function f may be live at the
+ * same time: their blocks nest
+ */
+static int arraysConflict(IrFunction * f, int j, int k)
+{ return !passEnabled("share-frame")
+         || (f->scopeFirst[j] <= f->scopeLast[k]
+             && f->scopeFirst[k] <= f->scopeLast[j]);
+}
+
+/* Function colourSlots gives each register of f
+ * but the parameters the lowest slot below fp free
+ * of the registers live with it where either is
+ * defined, and returns the slots taken
+ */
+static int colourSlots(IrFunction * f)
+{ IrBlock * b;
+  IrInstr ** instrs;
+  char ** liveIn, * live, * used, * conflict;
+  int n = f->nregs, r, q, d, k, slot, slots = 0;
+  int share = passEnabled("share-frame");
+  used = (char *) calloc(n + 1, 1);
+  conflict = (char *) calloc((size_t) n * n + 1, 1);
+  live = (char *) malloc(n + 1);
+  instrs = (IrInstr **) malloc((longestBlock(f) + 1) * sizeof(IrInstr *));
+  liveIn = liveness(f);
+  /* registers read before they are set are live
+     together from the entry */
+  for (r = 0; r < n; r++)
+    for (q = 0; q < n; q++)
+      if (liveIn[f->entry->id][r] && liveIn[f->entry->id][q])
+        conflict[r * n + q] = TRUE;
+  for (b = f->entry; b != NULL; b = b->next)
+  { liveOut(f, b, liveIn, live);
+    k = blockInstrs(b, instrs);
+    while (--k >= 0)
+    { d = definesReg(instrs[k]);
+      if (d >= 0)
+      { used[d] = TRUE;
+        for (r = 0; r < n; r++)
+          if (live[r] && r != d)
+            conflict[d * n + r] = conflict[r * n + d] = TRUE;
+      }
+      liveBefore(instrs[k], live);
+      for (r = 0; r < n; r++)
+        used[r] |= live[r];
+    }
+  }
+  for (r = f->nparams; r < n; r++)
+  { if (!used[r])
+      continue;
+    slot = share ? 1 : slots + 1;
+    for (q = f->nparams; q < r; q++)
+      if (home[q] == -slot && conflict[r * n + q])
+      { slot++;
+        q = f->nparams - 1;
+      }
+    home[r] = -slot;
+    if (slot > slots)
+      slots = slot;
+  }
+  freeLiveness(f, liveIn);
+  free(used);
+  free(conflict);
+  free(live);
+  free(instrs);
+  return slots;
+}
+
+/* Procedure layoutFrame gives each register used
+ * and each local array of function f its home
+ * below fp, and returns the words taken. The
+ * arrays go below the register slots, each at the
+ * lowest depth free of the arrays it conflicts with
+ */
+static int layoutFrame(IrFunction * f)
+{ int r, j, k, base, size, slots, words;
+  free(home);
+  home = (int *) malloc((f->nregs + 1) * sizeof(int));
+  for (r = 0; r < f->nregs; r++)
+    home[r] = r < f->nparams ? PARAMOFFSET + r : 0;
+  slots = colourSlots(f);
+  words = slots;
+  for (k = 0; k < f->narrays; k++)
+  { size = f->arrays[k]->size;
+    base = slots;
+    for (j = 0; j < k; j++)
+      if (arraysConflict(f, j, k)
+          && base < -f->arrays[j]->offset
+          && -f->arrays[j]->offset - f->arrays[j]->size < base + size)
+      { base = -f->arrays[j]->offset;
+        j = -1;
+      }
+    f->arrays[k]->offset = -(base + size);
+    if (base + size > words)
+      words = base + size;
+  }
+  return words;
+}
+
+/* Procedure genFunction generates function f */
+static void genFunction(IrFunction * f)
+{ IrBlock * b;
+  IrInstr * i;
+  char comment[128];
+  fn = f;
+  if (TraceCode)
+  { sprintf(comment, "-> function declaration %s", f->name);
+    emitComment(comment);
+  }
+  placeLabel(functionLabel[f->sym->offset]);
+  if (!emitBuiltin(f->name))
+  { emitRM(opENTER, fp, layoutFrame(f), mp, "push fp and allocate frame");
+    for (b = f->entry; b != NULL; b = b->next)
+      b->label = newLabel();
+    for (b = f->entry; b != NULL; b = b->next)
+    { placeLabel(b->label);
+      if (TraceCode)
+      { sprintf(comment, "B%d", b->id);
+        emitComment(comment);
+      }
+      for (i = b->first; i != NULL; i = i->next)
+        if (i->op == IrCall && isTailCall(i))
+        { genTailCall(i);
+          break;
+        }
+        else
+          genInstr(b, i);
+    }
+  }
+  if (TraceCode)
+  { sprintf(comment, "<- function declaration %s end", f->name);
+    emitComment(comment);
+  }
+}
+
+/* Procedure irCodeGen generates TM code for the
+ * functions of program to the code file, with
+ * the same prelude and calling convention as
+ * codeGen. codefile names the file in a comment
+ */
+void irCodeGen(IrFunction * program, char * codefile)
+{ IrFunction * f, * entry = NULL;
+  int size = 0;
+  for (f = program; f != NULL; f = f->next)
+  { if (f->sym->offset >= size)
+      size = f->sym->offset + 1;
+    if (strcmp(f->name, "main") == 0)
+      entry = f;
+  }
+  functionLabel = (int *) malloc((size + 1) * sizeof(int));
+  for (f = program; f != NULL; f = f->next)
+    functionLabel[f->sym->offset] = newLabel();
+  emitPrelude(codefile, functionLabel[entry->sym->offset]);
+  for (f = program; f != NULL; f = f->next)
+    genFunction(f);
+}
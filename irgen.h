@@ -0,0 +1,19 @@
+/****************************************************/
+/* File: irgen.h                                    */
+/* TM code generation from the IR                   */
+/* for the C- compiler                              */
+/****************************************************/
+
+#ifndef _IRGEN_H_
+#define _IRGEN_H_
+
+#include "ir.h"
+
+/* Procedure irCodeGen generates TM code for the
+ * functions of program to the code file, with
+ * the same prelude and calling convention as
+ * codeGen. codefile names the file in a comment
+ */
+void irCodeGen(IrFunction * program, char * codefile);
+
+#endif
@@ -0,0 +1,259 @@
+/****************************************************/
+/* File: irpass.c                                   */
+/* Optimizations over the IR for the C- compiler:   */
+/* control-flow simplification, folding and         */
+/* propagation within blocks, and dead code         */
+/* elimination from liveness over the graph         */
+/****************************************************/
+
+#include "globals.h"
+#include "fold.h"
+#include "ir.h"
+#include "irpass.h"
+
+/* Function removeInstr unlinks instruction i,
+ * which follows prev or heads block b if prev is
+ * NULL, and returns prev
+ */
+static IrInstr * removeInstr(IrBlock * b, IrInstr * prev, IrInstr * i)
+{ if (prev == NULL)
+    b->first = i->next;
+  else
+    prev->next = i->next;
+  if (b->last == i)
+    b->last = prev;
+  return prev;
+}
+
+/* Function isEmptyJump returns TRUE if block b
+ * does nothing but jump elsewhere
+ */
+static int isEmptyJump(IrBlock * b)
+{ return b->first == b->last && b->first->op == IrJump
+         && b->first->target[0] != b;
+}
+
+/* Procedure mark marks block b and the blocks
+ * reachable from it
+ */
+static void mark(IrBlock * b, char * reached)
+{ IrBlock * succ[2];
+  int k;
+  if (reached[b->id])
+    return;
+  reached[b->id] = TRUE;
+  for (k = successors(b, succ) - 1; k >= 0; k--)
+    mark(succ[k], reached);
+}
+
+/* Function simplifyCfg threads jumps through
+ * blocks that only jump, drops unreachable blocks
+ * and merges a block into its only predecessor
+ * when that jumps to it
+ */
+int simplifyCfg(IrFunction * f)
+{ IrBlock * b, * c, * prev;
+  IrInstr * i;
+  char * reached;
+  int k, hops, changes = 0, merged = TRUE;
+  for (b = f->entry; b != NULL; b = b->next)
+  { i = b->last;
+    for (k = 0; k < 2; k++)
+      for (hops = 0; i->target[k] != NULL && isEmptyJump(i->target[k])
+                     && hops < f->nblocks; hops++)
+      { i->target[k] = i->target[k]->first->target[0];
+        changes++;
+      }
+    if (i->op == IrBranch && i->target[0] == i->target[1])
+    { i->op = IrJump;
+      i->a.kind = IrNone;
+      i->b.kind = IrNone;
+      i->target[1] = NULL;
+      changes++;
+    }
+  }
+  buildCfg(f);
+  reached = (char *) calloc(f->nblocks, 1);
+  mark(f->entry, reached);
+  for (prev = f->entry, b = f->entry->next; b != NULL; b = b->next)
+    if (reached[b->id])
+      prev = b;
+    else
+    { prev->next = b->next;
+      changes++;
+    }
+  free(reached);
+  while (merged)
+  { merged = FALSE;
+    buildCfg(f);
+    for (b = f->entry; b != NULL; b = b->next)
+    { c = b->last->op == IrJump ? b->last->target[0] : NULL;
+      if (c == NULL || c == b || c == f->entry || c->npreds != 1)
+        continue;
+      /* c runs only after b: its code replaces the
+         jump ending b */
+      if (b->first == b->last)
+        b->first = c->first;
+      else
+      { for (i = b->first; i->next != b->last; i = i->next)
+          ;
+        i->next = c->first;
+      }
+      b->last = c->last;
+      for (prev = f->entry; prev->next != c; prev = prev->next)
+        ;
+      prev->next = c->next;
+      changes++;
+      merged = TRUE;
+      break;
+    }
+  }
+  return changes;
+}
+
+/* Procedure substitute replaces the registers
+ * instruction i reads by the values known for them
+ */
+static int substitute(IrInstr * i, IrValue * known)
+{ IrValue * uses[2 + 64], ** use = uses;
+  int n, k, changes = 0;
+  if (i->nargs > 64)
+    use = (IrValue **) malloc((2 + i->nargs) * sizeof(IrValue *));
+  n = usedValues(i, use);
+  for (k = 0; k < n; k++)
+    if (use[k]->kind == IrReg && known[use[k]->val].kind != IrNone)
+    { *use[k] = known[use[k]->val];
+      changes++;
+    }
+  if (use != uses)
+    free(use);
+  return changes;
+}
+
+/* Function foldBlocks propagates the constants and
+ * copies made in each block to the later uses in
+ * that block, and evaluates operations whose
+ * operands are then constant
+ */
+int foldBlocks(IrFunction * f)
+{ IrBlock * b;
+  IrInstr * i;
+  IrValue * known;
+  int r, d, val, changes = 0;
+  known = (IrValue *) malloc(f->nregs * sizeof(IrValue));
+  for (b = f->entry; b != NULL; b = b->next)
+  { for (r = 0; r < f->nregs; r++)
+      known[r].kind = IrNone;
+    for (i = b->first; i != NULL; i = i->next)
+    { changes += substitute(i, known);
+      switch (i->op)
+      { case IrBinary:
+          if (i->a.kind == IrImm && i->b.kind == IrImm
+              && evaluate(i->oper, i->a.val, i->b.val, &val))
+          { i->op = IrCopy;
+            i->a.val = val;
+            i->b.kind = IrNone;
+            changes++;
+          }
+          else if (i->b.kind == IrImm
+                   && ((i->b.val == 0 && (i->oper == PLUS || i->oper == MINUS))
+                       || (i->b.val == 1
+                           && (i->oper == TIMES || i->oper == OVER))))
+          { i->op = IrCopy;
+            i->b.kind = IrNone;
+            changes++;
+          }
+          break;
+        case IrLoad:
+        case IrStore:
+          if (i->a.kind == IrImm)
+          { i->disp += i->a.val;
+            i->a.kind = IrNone;
+            changes++;
+          }
+          break;
+        case IrBranch:
+          if (i->a.kind == IrImm && i->b.kind == IrImm)
+          { evaluate(i->oper, i->a.val, i->b.val, &val);
+            i->op = IrJump;
+            if (!val)
+              i->target[0] = i->target[1];
+            i->target[1] = NULL;
+            i->a.kind = IrNone;
+            i->b.kind = IrNone;
+            changes++;
+          }
+          break;
+        default:
+          break;
+      }
+      d = definesReg(i);
+      if (d < 0)
+        continue;
+      /* values read from d are no longer known */
+      for (r = 0; r < f->nregs; r++)
+        if (known[r].kind == IrReg && known[r].val == d)
+          known[r].kind = IrNone;
+      known[d].kind = IrNone;
+      if (i->op == IrCopy && !(i->a.kind == IrReg && i->a.val == d))
+        known[d] = i->a;
+    }
+  }
+  free(known);
+  buildCfg(f);
+  return changes;
+}
+
+/* Function isRemovable returns TRUE if
+ * instruction i has no effect but its result
+ */
+static int isRemovable(IrInstr * i)
+{ switch (i->op)
+  { case IrCopy:
+    case IrAddress:
+    case IrLoad:
+      return TRUE;
+    case IrBinary:
+      /* a division by zero would trap */
+      return i->oper != OVER || (i->b.kind == IrImm && i->b.val != 0);
+    default:
+      return FALSE;
+  }
+}
+
+/* Function removeDeadCode computes the registers
+ * live at each block's entry and removes the
+ * instructions whose results are never read
+ */
+int removeDeadCode(IrFunction * f)
+{ IrBlock * b;
+  IrInstr * i, * prev, ** instrs;
+  char ** liveIn, * live;
+  int k, r, changes = 0;
+  liveIn = liveness(f);
+  live = (char *) malloc(f->nregs);
+  instrs = (IrInstr **) malloc((longestBlock(f) + 1) * sizeof(IrInstr *));
+  for (b = f->entry; b != NULL; b = b->next)
+  { liveOut(f, b, liveIn, live);
+    k = blockInstrs(b, instrs);
+    while (--k >= 0)
+    { i = instrs[k];
+      r = definesReg(i);
+      if (r >= 0 && !live[r])
+      { if (isRemovable(i))
+        { prev = k > 0 ? instrs[k - 1] : NULL;
+          removeInstr(b, prev, i);
+          changes++;
+          continue;
+        }
+        if (i->op == IrCall)
+          i->dst = -1;
+      }
+      liveBefore(i, live);
+    }
+  }
+  freeLiveness(f, liveIn);
+  free(live);
+  free(instrs);
+  return changes;
+}
@@ -0,0 +1,33 @@
+/****************************************************/
+/* File: irpass.h                                   */
+/* Optimizations over the IR for the C- compiler.   */
+/* Each returns the number of changes it made       */
+/****************************************************/
+
+#ifndef _IRPASS_H_
+#define _IRPASS_H_
+
+#include "ir.h"
+
+/* Function simplifyCfg threads jumps through
+ * blocks that only jump, drops unreachable blocks
+ * and merges a block into its only predecessor
+ * when that jumps to it
+ */
+int simplifyCfg(IrFunction * f);
+
+/* Function foldBlocks propagates the constants and
+ * copies made in each block to the later uses in
+ * that block, and evaluates operations whose
+ * operands are then constant
+ */
+int foldBlocks(IrFunction * f);
+
+/* Function removeDeadCode computes the registers
+ * live at each block's entry, iterating over the
+ * graph until nothing changes, and removes the
+ * instructions whose results are never read
+ */
+int removeDeadCode(IrFunction * f);
+
+#endif
@@ -0,0 +1,404 @@
+/****************************************************/
+/* File: loop.c                                     */
+/* Loop optimization for the C- compiler:           */
+/* invariant code motion into a preheader block and */
+/* strength reduction of array addressing, done on  */
+/* the syntax tree innermost loop first             */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "regalloc.h"
+#include "loop.h"
+
+/* A Hoisted is an invariant expression of the
+ * loop being optimized and the local holding it
+ */
+typedef struct hoistRec
+   { TreeNode * exp;
+     Symbol * temp;
+     struct hoistRec * next;
+   } * Hoisted;
+
+/* the loop being optimized, and the preheader
+   being built for it: declarations and
+   statements run before it */
+static TreeNode * loop;
+static int loopCalls;
+static TreeNode * decls;
+static TreeNode * pre;
+static Hoisted hoisted;
+
+/* arrays not worth an address, for the
+   induction variable being reduced */
+#define MAXSKIP 16
+static Symbol * skipped[MAXSKIP];
+static int skips;
+
+/* number of the next local made */
+static int tempCount;
+
+/* counts for the report */
+static int loops;
+static int invariants;
+static int pointers;
+static int crowded;
+
+/* Function copyExp returns a copy of expression t */
+static TreeNode * copyExp(TreeNode * t)
+{ TreeNode * n;
+  int i;
+  if (t == NULL)
+    return NULL;
+  n = (TreeNode *) malloc(sizeof(TreeNode));
+  *n = *t;
+  n->sibling = NULL;
+  for (i = 0; i < MAXCHILDREN; i++)
+    n->child[i] = copyExp(t->child[i]);
+  return n;
+}
+
+/* Function isInvariant returns TRUE if expression
+ * t computes the same value on every iteration of
+ * the loop and may be computed before it even if
+ * it would not run: it loads no array element,
+ * divides by no variable and calls nothing
+ */
+static int isInvariant(TreeNode * t)
+{ switch (t->kind.exp)
+  { case ConstK:
+      return TRUE;
+    case IdK:
+      if (t->sym->storage == GlobalS && loopCalls)
+        return FALSE;
+      return countAssigns(loop, t->sym) == 0;
+    case IdArrayK:
+      /* the address of an array */
+      return t->child[0] == NULL && t->sym != &memory;
+    case OpK:
+      if (t->attr.op == OVER && (t->child[1]->kind.exp != ConstK
+                                 || t->child[1]->attr.val == 0))
+        return FALSE;
+      return isInvariant(t->child[0]) && isInvariant(t->child[1]);
+    default:
+      return FALSE;
+  }
+}
+
+/* Function newTemp declares a new local of the
+ * preheader block and returns its symbol
+ */
+static Symbol * newTemp(char * kind, int lineno)
+{ Symbol * sym = (Symbol *) malloc(sizeof(Symbol));
+  TreeNode * d;
+  sym->name = (char *) malloc(16);
+  sprintf(sym->name, "%s.%d", kind, ++tempCount);
+  sym->storage = LocalS;
+  sym->offset = 0;
+  sym->size = 1;
+  d = newExpNode(VarK);
+  d->type = Integer;
+  d->lineno = lineno;
+  d->attr.name = sym->name;
+  d->sym = sym;
+  d->sibling = decls;
+  decls = d;
+  return sym;
+}
+
+/* Procedure addPre appends statement t to the
+ * preheader
+ */
+static void addPre(TreeNode * t)
+{ TreeNode ** link = &pre;
+  while (*link != NULL)
+    link = &(*link)->sibling;
+  *link = t;
+}
+
+/* Function isArith returns TRUE for the operators
+ * worth keeping the value of: a comparison is
+ * better left to the test it is used in
+ */
+static int isArith(TokenType op)
+{ return op == PLUS || op == MINUS || op == TIMES || op == OVER;
+}
+
+/* Procedure hoist replaces the maximal invariant
+ * operator subtrees of t and its siblings by
+ * locals computed in the preheader
+ */
+static void hoist(TreeNode * t)
+{ Hoisted h;
+  int i;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK && t->kind.exp == OpK && isArith(t->attr.op)
+        && isInvariant(t))
+    { for (h = hoisted; h != NULL; h = h->next)
+        if (sameExp(h->exp, t))
+          break;
+      if (h == NULL)
+      { h = (Hoisted) malloc(sizeof(struct hoistRec));
+        h->exp = copyExp(t);
+        h->temp = newTemp("inv", t->lineno);
+        h->next = hoisted;
+        hoisted = h;
+        addPre(newAssign(h->temp, copyExp(t)));
+      }
+      t->kind.exp = IdK;
+      t->attr.name = h->temp->name;
+      t->sym = h->temp;
+      t->child[0] = NULL;
+      t->child[1] = NULL;
+      invariants++;
+      continue;
+    }
+    for (i = 0; i < MAXCHILDREN; i++)
+      if (t->nodekind != ExpK || t->kind.exp != AssignK || i != 0
+          || t->child[0]->kind.exp != IdK)
+        hoist(t->child[i]);
+  }
+}
+
+/* Function countScalars returns the number of
+ * locals and parameters named by tree t and its
+ * siblings, adding them to the n in syms
+ */
+static int countScalars(TreeNode * t, Symbol ** syms, int n)
+{ int i;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK && t->kind.exp == IdK
+        && t->sym->storage != GlobalS)
+    { for (i = 0; i < n && syms[i] != t->sym; i++)
+        ;
+      if (i == n && n <= NVARREGS)
+        syms[n++] = t->sym;
+    }
+    for (i = 0; i < MAXCHILDREN; i++)
+      n = countScalars(t->child[i], syms, n);
+  }
+  return n;
+}
+
+/* Function indexOffset returns TRUE if t indexes
+ * an array by iv, iv+k or iv-k, setting k
+ */
+static int indexOffset(TreeNode * t, Symbol * iv, int * k)
+{ if (t == NULL)
+    return FALSE;
+  if (t->kind.exp == IdK && t->sym == iv)
+  { *k = 0;
+    return TRUE;
+  }
+  if (t->kind.exp == OpK && (t->attr.op == PLUS || t->attr.op == MINUS)
+      && t->child[0]->kind.exp == IdK && t->child[0]->sym == iv
+      && t->child[1]->kind.exp == ConstK)
+  { *k = t->attr.op == PLUS ? t->child[1]->attr.val : -t->child[1]->attr.val;
+    return TRUE;
+  }
+  return FALSE;
+}
+
+/* Function countAccesses returns the number of
+ * elements of array sym that tree t and its
+ * siblings access by iv
+ */
+static int countAccesses(TreeNode * t, Symbol * sym, Symbol * iv)
+{ int i, k, n = 0;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK && t->kind.exp == IdArrayK && t->sym == sym
+        && indexOffset(t->child[0], iv, &k))
+      n++;
+    for (i = 0; i < MAXCHILDREN; i++)
+      n += countAccesses(t->child[i], sym, iv);
+  }
+  return n;
+}
+
+/* Procedure redirect makes the accesses counted
+ * by countAccesses go through address p
+ */
+static void redirect(TreeNode * t, Symbol * sym, Symbol * iv, Symbol * p)
+{ int i, k;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK && t->kind.exp == IdArrayK && t->sym == sym
+        && indexOffset(t->child[0], iv, &k))
+    { t->sym = &memory;
+      t->attr.name = memory.name;
+      if (k == 0)
+        t->child[0] = newId(p, t->lineno);
+      else
+        t->child[0] = newOp(k > 0 ? PLUS : MINUS, newId(p, t->lineno),
+                            newConst(k > 0 ? k : -k, t->lineno));
+      continue;
+    }
+    for (i = 0; i < MAXCHILDREN; i++)
+      redirect(t->child[i], sym, iv, p);
+  }
+}
+
+/* Function isSkipped returns TRUE if array sym
+ * has too few accesses to be given an address
+ */
+static int isSkipped(Symbol * sym)
+{ int i;
+  for (i = 0; i < skips; i++)
+    if (skipped[i] == sym)
+      return TRUE;
+  return FALSE;
+}
+
+/* Function nextArray returns an array other than
+ * mem that tree t accesses by iv, or NULL
+ */
+static Symbol * nextArray(TreeNode * t, Symbol * iv)
+{ Symbol * s;
+  int i, k;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK && t->kind.exp == IdArrayK
+        && t->sym != &memory && t->sym->storage != GlobalS
+        && !isSkipped(t->sym) && indexOffset(t->child[0], iv, &k))
+      return t->sym;
+    for (i = 0; i < MAXCHILDREN; i++)
+      if ((s = nextArray(t->child[i], iv)) != NULL)
+        return s;
+  }
+  return NULL;
+}
+
+/* Procedure reduce steps an address along with
+ * each induction variable of the loop: a local
+ * or parameter whose one assignment in the loop
+ * is a statement of the body i = i + c or i - c.
+ * Each array of the function indexed by it gets
+ * an address p = a + i set in the preheader and
+ * stepped right after i. A global array is left
+ * alone, as its elements are already loaded with
+ * the index as base register. So is every array
+ * of a loop naming NVARREGS or more scalars, as
+ * in minloc: the address would live in memory,
+ * and loading and storing it to step it costs
+ * more than the add and load it saves
+ */
+static void reduce(TreeNode * body)
+{ TreeNode * s, * step, * addr;
+  Symbol * iv, * arr, * p;
+  Symbol * syms[NVARREGS + 1];
+  int n, c, saving;
+  for (s = body; s != NULL; s = s->sibling)
+  { if (s->nodekind != ExpK || s->kind.exp != AssignK
+        || s->child[0]->kind.exp != IdK)
+      continue;
+    iv = s->child[0]->sym;
+    step = s->child[1];
+    if (iv->storage == GlobalS || step->kind.exp != OpK
+        || (step->attr.op != PLUS && step->attr.op != MINUS)
+        || step->child[0]->kind.exp != IdK || step->child[0]->sym != iv
+        || step->child[1]->kind.exp != ConstK
+        || countAssigns(loop, iv) != 1)
+      continue;
+    c = step->child[1]->attr.val;
+    skips = 0;
+    while (skips < MAXSKIP && (arr = nextArray(loop, iv)) != NULL)
+    { /* an address left in memory would cost more
+         than it saves */
+      if (countScalars(loop, syms, 0) >= NVARREGS)
+      { crowded++;
+        break;
+      }
+      n = countAccesses(loop, arr, iv);
+      /* an access through the address saves the
+         index add, and the load of an array
+         parameter; stepping costs one LDA */
+      saving = n * (arr->storage == ParamS ? 2 : 1);
+      if (saving < 2)
+      { skipped[skips++] = arr;
+        continue;
+      }
+      p = newTemp("ptr", s->lineno);
+      addr = newExpNode(OpK);
+      addr->type = Integer;
+      addr->lineno = s->lineno;
+      addr->attr.op = PLUS;
+      addr->child[0] = newExpNode(IdArrayK);
+      addr->child[0]->attr.name = arr->name;
+      addr->child[0]->sym = arr;
+      addr->child[0]->lineno = s->lineno;
+      addr->child[1] = newId(iv, s->lineno);
+      addPre(newAssign(p, addr));
+      redirect(loop, arr, iv, p);
+      addr = newAssign(p, newOp(step->attr.op, newId(p, s->lineno),
+                                          newConst(c, s->lineno)));
+      addr->sibling = s->sibling;
+      s->sibling = addr;
+      pointers++;
+    }
+  }
+}
+
+/* Procedure optimizeLoop optimizes while loop t
+ * and wraps it with its preheader in a block
+ */
+static void optimizeLoop(TreeNode * t)
+{ TreeNode * w, * body;
+  loop = t;
+  loopCalls = hasCall(t);
+  decls = NULL;
+  pre = NULL;
+  hoisted = NULL;
+  body = t->child[1];
+  if (body != NULL && body->nodekind == StmtK && body->kind.stmt == CompoundK)
+    body = body->child[1];
+  reduce(body);
+  hoist(t->child[0]);
+  hoist(t->child[1]);
+  if (pre == NULL)
+    return;
+  loops++;
+  w = (TreeNode *) malloc(sizeof(TreeNode));
+  *w = *t;
+  w->sibling = NULL;
+  addPre(w);
+  t->kind.stmt = CompoundK;
+  t->child[0] = decls;
+  t->child[1] = pre;
+  t->child[2] = NULL;
+}
+
+/* Procedure loopStmts optimizes the loops of a
+ * statement list, inner loops first
+ */
+static void loopStmts(TreeNode * t)
+{ int i;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind != StmtK)
+      continue;
+    for (i = 0; i < MAXCHILDREN; i++)
+      loopStmts(t->child[i]);
+    if (t->kind.stmt == WhileK)
+      optimizeLoop(t);
+  }
+}
+
+/* Procedure optimizeLoops hoists the invariant
+ * computations of each while loop into a block
+ * run before it, and replaces array accesses
+ * indexed by an induction variable by accesses
+ * through an address stepped along with it
+ */
+void optimizeLoops(TreeNode * syntaxTree)
+{ TreeNode * t;
+  loops = 0;
+  invariants = 0;
+  pointers = 0;
+  crowded = 0;
+  tempCount = 0;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+      loopStmts(t->child[1]);
+  if (TraceOptimize)
+    fprintf(listing, "\nLoops:\n  %d loops given a preheader, %d invariant "
+            "computations hoisted, %d addresses stepped, %d left for "
+            "want of a register\n", loops, invariants, pointers, crowded);
+}
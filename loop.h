@@ -0,0 +1,17 @@
+/****************************************************/
+/* File: loop.h                                     */
+/* Loop optimization for the C- compiler            */
+/****************************************************/
+
+#ifndef _LOOP_H_
+#define _LOOP_H_
+
+/* Procedure optimizeLoops hoists the invariant
+ * computations of each while loop into a block
+ * run before it, and replaces array accesses
+ * indexed by an induction variable by accesses
+ * through an address stepped along with it
+ */
+void optimizeLoops(TreeNode * syntaxTree);
+
+#endif
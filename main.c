@@ -25,7 +25,15 @@
 #if !NO_ANALYZE
 #include "analyze.h"
 #if !NO_CODE
+#include "code.h"
 #include "cgen.h"
+#include "ir.h"
+#include "irgen.h"
+#include "optimize.h"
+#include "unroll.h"
+#include "exec.h"
+#include "x86gen.h"
+#include "profile.h"
 #endif
 #endif
 #endif
@@ -42,17 +50,129 @@ int TraceScan = FALSE;
 int TraceParse = FALSE;
 int TraceAnalyze = FALSE;
 int TraceCode = TRUE;
+int TraceOptimize = FALSE;
+int TraceIR = FALSE;
+int CodeFromIR = FALSE;
+int ReportPasses = FALSE;
+int ProfileGenerate = FALSE;
+int ProfileUse = FALSE;
 
 int Error = FALSE;
 
+/* RunCode = TRUE causes the code to be run on the
+ * embedded TM once it is generated, with the
+ * listing sent to stderr so that stdout holds
+ * only what the program writes
+ */
+static int RunCode = FALSE;
+
+/* NativeCode = TRUE causes x86-64 assembly to be
+ * generated from the IR instead of TM code, and
+ * built with gcc into an executable
+ */
+static int NativeCode = FALSE;
+
+/* WriteCode = TRUE causes the code file to be
+ * written. It is -1 until -fwrite-code or
+ * -fno-write-code sets it, and then the code file
+ * is written unless the code is run
+ */
+static int WriteCode = -1;
+
+/* flags holds the globals set by -f<name> and
+   cleared by -fno-<name> */
+static struct { char * name; int * flag; } flags[] =
+   { { "echo-source", &EchoSource },
+     { "trace-scan", &TraceScan },
+     { "trace-parse", &TraceParse },
+     { "trace-analyze", &TraceAnalyze },
+     { "trace-code", &TraceCode },
+     { "trace-optimize", &TraceOptimize },
+     { "dump-ir", &TraceIR },
+     { "ir", &CodeFromIR },
+     { "time-report", &ReportPasses },
+     { "write-code", &WriteCode },
+     { "profile-generate", &ProfileGenerate },
+     { "profile-use", &ProfileUse },
+     { NULL, NULL }
+   };
+
+/* Function setFlag sets the flag called name to
+ * on, or turns the passes called name on or off.
+ * It returns FALSE if there is no such flag or pass
+ */
+static int setFlag(char * name, int on)
+{ int i;
+  for (i = 0; flags[i].name != NULL; i++)
+    if (strcmp(flags[i].name, name) == 0)
+    { *flags[i].flag = on;
+      return TRUE;
+    }
+#if !NO_PARSE && !NO_ANALYZE && !NO_CODE
+  return enablePass(name, on);
+#else
+  return FALSE;
+#endif
+}
+
+/* Procedure usage prints how to run the compiler
+ * and stops
+ */
+static void usage(char * name)
+{ fprintf(stderr,"usage: %s [--run] [--target=tm|x86-64] [-O0|-O1|-O2] [-funroll-factor=<n>] [-f<flag>|-fno-<flag>]... <filename>\n",
+          name);
+  fprintf(stderr,"  -O0 turns every pass off, those of the code generators too;\n"
+                 "  calls still use CALL/RET, expression temporaries registers\n"
+                 "  and constant operators shifts, so the code is not that of\n"
+                 "  the compiler before them\n");
+  exit(1);
+}
+
 main( int argc, char * argv[] )
 { TreeNode * syntaxTree;
   char pgm[120]; /* source code file name */
-  if (argc != 2)
-    { fprintf(stderr,"usage: %s <filename>\n",argv[0]);
-      exit(1);
+  int i;
+  pgm[0] = '\0';
+  for (i = 1; i < argc; i++)
+    if (argv[i][0] != '-')
+    { if (pgm[0] != '\0' || strlen(argv[i]) > 110)
+        usage(argv[0]);
+      strcpy(pgm,argv[i]);
     }
-  strcpy(pgm,argv[1]) ;
+    else if (strcmp(argv[i],"--run") == 0)
+      RunCode = TRUE;
+    else if (strcmp(argv[i],"--target=tm") == 0)
+      NativeCode = FALSE;
+    else if (strcmp(argv[i],"--target=x86-64") == 0)
+      NativeCode = TRUE;
+#if !NO_PARSE && !NO_ANALYZE && !NO_CODE
+    else if (argv[i][1] == 'O' && argv[i][2] >= '0'
+             && argv[i][2] <= '0' + MAXLEVEL && argv[i][3] == '\0')
+      setOptimizeLevel(argv[i][2] - '0');
+    else if (strncmp(argv[i],"-funroll-factor=",16) == 0
+             && atoi(argv[i]+16) >= 1 && atoi(argv[i]+16) <= MAXFACTOR)
+      setUnrollFactor(atoi(argv[i]+16));
+#endif
+    else if (strncmp(argv[i],"-fno-",5) == 0 && setFlag(argv[i]+5,FALSE))
+      ;
+    else if (strncmp(argv[i],"-f",2) == 0 && setFlag(argv[i]+2,TRUE))
+      ;
+    else
+    { fprintf(stderr,"unknown option %s\n",argv[i]);
+      usage(argv[0]);
+    }
+  if (pgm[0] == '\0')
+    usage(argv[0]);
+  /* only the tree code generator places probes */
+  if (ProfileGenerate && (CodeFromIR || NativeCode))
+  { fprintf(stderr,"-fprofile-generate needs --target=tm without -fir\n");
+    exit(1);
+  }
+  if (WriteCode < 0)
+    WriteCode = !RunCode;
+  /* comments only go to the code file */
+  if (!WriteCode)
+    TraceCode = FALSE;
   if (strchr (pgm, '.') == NULL)
      strcat(pgm,".tny");
   source = fopen(pgm,"r");
@@ -60,7 +180,7 @@ main( int argc, char * argv[] )
   { fprintf(stderr,"File %s not found\n",pgm);
     exit(1);
   }
-  listing = stdout; /* send listing to screen */
+  listing = RunCode ? stderr : stdout; /* send listing to screen */
   fprintf(listing,"\nC- COMPILATION: %s\n",pgm);
 #if NO_PARSE
   while (getToken()!=ENDFILE);
@@ -80,18 +200,75 @@ main( int argc, char * argv[] )
   }
 #if !NO_CODE
   if (! Error)
-  { char * codefile;
+  { IrFunction * program, * f;
+    char * codefile, * exefile, * proffile;
     int fnlen = strcspn(pgm,".");
     codefile = (char *) calloc(fnlen+4, sizeof(char));
     strncpy(codefile,pgm,fnlen);
-    strcat(codefile,".tm");
-    code = fopen(codefile,"w");
-    if (code == NULL)
-    { printf("Unable to open %s\n",codefile);
-      exit(1);
+    strcat(codefile,NativeCode ? ".s" : ".tm");
+    exefile = (char *) calloc(fnlen+1, sizeof(char));
+    strncpy(exefile,pgm,fnlen);
+    proffile = (char *) calloc(fnlen+6, sizeof(char));
+    strncpy(proffile,pgm,fnlen);
+    strcat(proffile,".prof");
+    /* gcc reads the assembly from its file */
+    if (NativeCode)
+      WriteCode = TRUE;
+    startProfile(syntaxTree);
+    if (ProfileGenerate)
+    { /* count each call and test where it is in
+         the source */
+      enablePass("inline",FALSE);
+      enablePass("unroll",FALSE);
+    }
+    if (ProfileUse)
+    { if (! readProfile(proffile))
+      { fprintf(stderr,"Profile %s not found\n",proffile);
+        exit(1);
+      }
+    }
+    if (WriteCode)
+    { code = fopen(codefile,"w");
+      if (code == NULL)
+      { printf("Unable to open %s\n",codefile);
+        exit(1);
+      }
+    }
+    optimizeTree(syntaxTree);
+    if (TraceIR || CodeFromIR || NativeCode)
+    { program = lowerProgram(syntaxTree);
+      if (TraceIR)
+      { fprintf(listing,"\nIR:\n");
+        for (f = program; f != NULL; f = f->next) dumpIr(f);
+      }
+      optimizeIr(program);
+      if (TraceIR)
+      { fprintf(listing,"\nIR after passes:\n");
+        for (f = program; f != NULL; f = f->next) dumpIr(f);
+      }
+      if (NativeCode)
+        x86CodeGen(program,codefile);
+      else if (CodeFromIR)
+        irCodeGen(program,codefile);
     }
-    codeGen(syntaxTree,codefile);
-    fclose(code);
+    if (! NativeCode)
+    { if (! CodeFromIR)
+        codeGen(syntaxTree,codefile);
+      optimizeCode();
+      if (WriteCode)
+        writeCode();
+    }
+    if (WriteCode)
+      fclose(code);
+    if (ReportPasses)
+      reportPasses();
+    if (ProfileUse)
+      reportProfile();
+    if (NativeCode && !assemble(codefile,exefile))
+      exit(1);
+    if (RunCode && !(NativeCode ? runExecutable(exefile)
+                     : runCode(codefile, ProfileGenerate ? proffile : NULL)))
+      exit(1);
   }
 #endif
 #endif
@@ -0,0 +1,253 @@
+/****************************************************/
+/* File: optimize.c                                 */
+/* Pass manager for the C- compiler: runs the       */
+/* syntax tree and IR passes the optimization level */
+/* and the -f flags enable, in order, timing each   */
+/* and counting the TM instructions it saves        */
+/****************************************************/
+
+#include "globals.h"
+#include "code.h"
+#include "cgen.h"
+#include "inline.h"
+#include "fold.h"
+#include "unroll.h"
+#include "propagate.h"
+#include "cse.h"
+#include "loop.h"
+#include "dead.h"
+#include "ir.h"
+#include "irpass.h"
+#include "irgen.h"
+#include "peephole.h"
+#include "optimize.h"
+#include <time.h>
+
+/* A Pass runs over the syntax tree, over each
+ * function of the IR, or over the TM code in the
+ * code buffer. One with no procedure is done by
+ * the code generators, which ask passEnabled if
+ * they are to do it. A pass runs at its level and
+ * above unless forced on or off by name
+ */
+typedef struct
+   { char * name;
+     int level;
+     void (* tree)(TreeNode * syntaxTree);
+     int (* ir)(IrFunction * f);
+     int (* code)(void);
+     int forced; /* TRUE if -f or -fno- named it */
+     int on; /* what they asked for */
+     int runs;
+     clock_t time;
+     int saved;
+   } Pass;
+
+/* passes is the pipeline: tree passes, then IR
+   passes, then those of the code generators and
+   then code passes */
+static Pass passes[] =
+   { { "inline", 2, inlineCalls, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "fold", 1, foldConstants, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "unroll", 2, unrollLoops, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "propagate", 1, propagateConstants, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "fold", 1, foldConstants, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "cse", 1, eliminateCommonSubexps, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "loops", 2, optimizeLoops, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "cse-addresses", 1, reuseAddresses, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "dead-stores", 1, removeDeadStores, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "unreachable", 1, removeUnreachable, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "dead-stores", 1, removeDeadStores, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "simplify-cfg", 1, NULL, simplifyCfg, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "fold", 1, NULL, foldBlocks, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "dead-code", 1, NULL, removeDeadCode, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "simplify-cfg", 1, NULL, simplifyCfg, NULL, FALSE, FALSE, 0, 0, 0 },
+     /* scalar variables kept in registers */
+     { "regalloc", 1, NULL, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     /* locals never live together share a slot */
+     { "share-frame", 1, NULL, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     /* if and while branch on a comparison */
+     { "compare-branch", 1, NULL, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     /* while loops tested at the bottom */
+     { "rotate-loops", 1, NULL, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     /* jumps to jumps and to the next location */
+     { "thread-jumps", 1, NULL, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     /* return f(...) reuses the frame */
+     { "tail-calls", 1, NULL, NULL, NULL, FALSE, FALSE, 0, 0, 0 },
+     { "peephole", 1, NULL, NULL, peephole, FALSE, FALSE, 0, 0, 0 },
+     { NULL, 0, NULL, NULL, NULL, FALSE, FALSE, 0, 0, 0 }
+   };
+
+/* the -O level */
+static int level = MAXLEVEL;
+
+/* TRUE once the IR passes have been run */
+static int irBuilt = FALSE;
+
+/* Procedure setOptimizeLevel makes the passes of
+ * level and below run, as -O<level> asks
+ */
+void setOptimizeLevel(int l)
+{ level = l;
+}
+
+/* Function enablePass turns the passes called
+ * name on or off whatever the level, as -f<name>
+ * and -fno-<name> ask. It returns FALSE if no
+ * pass is called name
+ */
+int enablePass(char * name, int on)
+{ Pass * p;
+  int found = FALSE;
+  for (p = passes; p->name != NULL; p++)
+    if (strcmp(p->name, name) == 0)
+    { p->forced = TRUE;
+      p->on = on;
+      found = TRUE;
+    }
+  return found;
+}
+
+/* Function isEnabled returns TRUE if pass p is to
+ * run
+ */
+static int isEnabled(Pass * p)
+{ return p->forced ? p->on : p->level <= level;
+}
+
+/* Function passEnabled returns TRUE if the pass
+ * called name is to run. The code generators ask
+ * it for the passes they do themselves
+ */
+int passEnabled(char * name)
+{ Pass * p;
+  for (p = passes; p->name != NULL; p++)
+    if (strcmp(p->name, name) == 0)
+      return isEnabled(p);
+  return FALSE;
+}
+
+/* Function treeCodeSize returns the number of TM
+ * instructions cgen makes of the syntax tree now,
+ * generating them into the code buffer and then
+ * discarding them
+ */
+static int treeCodeSize(TreeNode * syntaxTree)
+{ int n;
+  resetCode();
+  codeGen(syntaxTree, "pass report");
+  n = codeSize();
+  resetCode();
+  return n;
+}
+
+/* Function irCodeSize returns the number of TM
+ * instructions made of the IR of program now
+ */
+static int irCodeSize(IrFunction * program)
+{ int n;
+  resetCode();
+  irCodeGen(program, "pass report");
+  n = codeSize();
+  resetCode();
+  return n;
+}
+
+/* Procedure optimizeTree runs the enabled syntax
+ * tree passes in order
+ */
+void optimizeTree(TreeNode * syntaxTree)
+{ Pass * p;
+  clock_t start;
+  int size = 0, after;
+  if (ReportPasses)
+    size = treeCodeSize(syntaxTree);
+  for (p = passes; p->name != NULL; p++)
+    if (p->tree != NULL && isEnabled(p))
+    { start = clock();
+      p->tree(syntaxTree);
+      p->time += clock() - start;
+      p->runs++;
+      if (ReportPasses)
+      { after = treeCodeSize(syntaxTree);
+        p->saved += size - after;
+        size = after;
+      }
+    }
+}
+
+/* Procedure optimizeIr runs the enabled IR passes
+ * in order over each function of program
+ */
+void optimizeIr(IrFunction * program)
+{ IrFunction * f;
+  Pass * p;
+  clock_t start;
+  int size = 0, after, changes;
+  irBuilt = TRUE;
+  if (ReportPasses)
+    size = irCodeSize(program);
+  for (p = passes; p->name != NULL; p++)
+    if (p->ir != NULL && isEnabled(p))
+    { start = clock();
+      changes = 0;
+      for (f = program; f != NULL; f = f->next)
+        if (f->entry != NULL)
+          changes += p->ir(f);
+      p->time += clock() - start;
+      p->runs++;
+      if (TraceOptimize)
+        fprintf(listing, "\nIR %s:\n  %d changes\n", p->name, changes);
+      if (ReportPasses)
+      { after = irCodeSize(program);
+        p->saved += size - after;
+        size = after;
+      }
+    }
+}
+
+/* Procedure optimizeCode runs the enabled code
+ * passes in order over the code buffer
+ */
+void optimizeCode(void)
+{ Pass * p;
+  clock_t start;
+  int size;
+  for (p = passes; p->name != NULL; p++)
+    if (p->code != NULL && isEnabled(p))
+    { start = clock();
+      size = codeSize();
+      p->code();
+      p->time += clock() - start;
+      p->runs++;
+      p->saved += size - codeSize();
+    }
+}
+
+/* Procedure reportPasses prints the time each
+ * pass took and the TM instructions it saved to
+ * the listing file
+ */
+void reportPasses(void)
+{ Pass * p;
+  clock_t time = 0;
+  int saved = 0;
+  fprintf(listing, "\nPasses at -O%d:\n", level);
+  fprintf(listing, "  %-19s %-4s %10s %8s\n", "pass", "on", "ms", "saved");
+  for (p = passes; p->name != NULL; p++)
+  { if (p->ir != NULL && !irBuilt)
+      continue;
+    fprintf(listing, "  %-4s %-14s %-4s",
+            p->tree != NULL ? "tree" : p->ir != NULL ? "ir"
+            : p->code != NULL ? "code" : "gen",
+            p->name, isEnabled(p) ? "yes" : "no");
+    if (p->runs > 0)
+      fprintf(listing, " %10.3f %8d", 1000.0 * p->time / CLOCKS_PER_SEC,
+              p->saved);
+    fprintf(listing, "\n");
+    time += p->time;
+    saved += p->saved;
+  }
+  fprintf(listing, "  %-24s %10.3f %8d\n", "total",
+          1000.0 * time / CLOCKS_PER_SEC, saved);
+}
@@ -0,0 +1,55 @@
+/****************************************************/
+/* File: optimize.h                                 */
+/* Pass manager for the C- compiler                 */
+/****************************************************/
+
+#ifndef _OPTIMIZE_H_
+#define _OPTIMIZE_H_
+
+#include "ir.h"
+
+/* MAXLEVEL is the highest optimization level, and
+ * the one the compiler runs at unless told
+ */
+#define MAXLEVEL 2
+
+/* Procedure setOptimizeLevel makes the passes of
+ * level and below run, as -O<level> asks
+ */
+void setOptimizeLevel(int level);
+
+/* Function enablePass turns the passes called
+ * name on or off whatever the level, as -f<name>
+ * and -fno-<name> ask. It returns FALSE if no
+ * pass is called name
+ */
+int enablePass(char * name, int on);
+
+/* Function passEnabled returns TRUE if the pass
+ * called name is to run. The code generators ask
+ * it for the passes they do themselves
+ */
+int passEnabled(char * name);
+
+/* Procedure optimizeTree runs the enabled syntax
+ * tree passes in order
+ */
+void optimizeTree(TreeNode * syntaxTree);
+
+/* Procedure optimizeIr runs the enabled IR passes
+ * in order over each function of program
+ */
+void optimizeIr(IrFunction * program);
+
+/* Procedure optimizeCode runs the enabled code
+ * passes in order over the code buffer
+ */
+void optimizeCode(void);
+
+/* Procedure reportPasses prints the time each
+ * pass took and the TM instructions it saved to
+ * the listing file
+ */
+void reportPasses(void);
+
+#endif
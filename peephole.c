@@ -0,0 +1,338 @@
+/****************************************************/
+/* File: peephole.c                                 */
+/* Peephole optimization of the TM code for the C-  */
+/* compiler: a table of patterns is matched at each */
+/* instruction in the code buffer, and the buffer   */
+/* is rewritten until no pattern applies. A pattern */
+/* never joins an instruction to one a jump may     */
+/* reach it by, and deleted instructions leave      */
+/* their location to the next one kept, so jumps    */
+/* keep their targets when the code is written      */
+/****************************************************/
+
+#include "globals.h"
+#include "code.h"
+#include "peephole.h"
+
+/* the code buffer and its size */
+static Instr * instr;
+static int size;
+
+/* isTarget[loc] is TRUE if a jump goes to loc or
+   a call returns there */
+static char * isTarget = NULL;
+
+/* A Pattern rewrites the code at a location if it
+ * matches there, and returns TRUE if it did
+ */
+typedef struct
+   { char * name;
+     int (* apply)(int loc);
+     int count;
+   } Pattern;
+
+/* Function is returns TRUE if the instruction at
+ * loc is op
+ */
+static int is(int loc, TmOp op)
+{ return instr[loc].op == op;
+}
+
+/* Function nextKept returns the location of the
+ * first instruction kept after loc, or -1
+ */
+static int nextKept(int loc)
+{ for (loc++; loc < size; loc++)
+    if (instr[loc].kept)
+      return loc;
+  return -1;
+}
+
+/* Function prevKept returns the location of the
+ * last instruction kept before loc, or -1
+ */
+static int prevKept(int loc)
+{ for (loc--; loc >= 0; loc--)
+    if (instr[loc].kept)
+      return loc;
+  return -1;
+}
+
+/* Procedure findTargets marks the locations the
+ * kept jumps go to and the calls return to
+ */
+static void findTargets(void)
+{ int loc;
+  memset(isTarget, 0, size + 1);
+  for (loc = 0; loc < size; loc++)
+    if (instr[loc].kept)
+    { if (instr[loc].target >= 0 && instr[loc].target <= size)
+        isTarget[instr[loc].target] = TRUE;
+      if (is(loc, opCALL))
+        isTarget[loc + 1] = TRUE;
+    }
+}
+
+/* Function isLeader returns TRUE if the kept
+ * instruction at loc may be reached other than
+ * from the one kept before it: a jump goes to it
+ * or to an instruction deleted in between
+ */
+static int isLeader(int loc)
+{ int l;
+  for (l = prevKept(loc) + 1; l <= loc; l++)
+    if (isTarget[l])
+      return TRUE;
+  return FALSE;
+}
+
+/* Function reads returns TRUE if the instruction
+ * at loc reads register r
+ */
+static int reads(int loc, int r)
+{ Instr * i = &instr[loc];
+  if (isRO(i->op))
+  { if (is(loc, opOUT))
+      return i->r == r;
+    if (is(loc, opIN) || is(loc, opHALT))
+      return FALSE;
+    return i->s == r || i->t == r;
+  }
+  if (is(loc, opLDC))
+    return FALSE;
+  if (is(loc, opLD) || is(loc, opLDA) || is(loc, opSHL) || is(loc, opSHR))
+    return i->s == r;
+  if (is(loc, opRET))
+    return i->r == r;
+  return i->r == r || i->s == r;
+}
+
+/* Function writes returns TRUE if the instruction
+ * at loc writes register r
+ */
+static int writes(int loc, int r)
+{ Instr * i = &instr[loc];
+  if (is(loc, opOUT) || is(loc, opHALT) || is(loc, opST) || isBranch(i->op))
+    return FALSE;
+  if (is(loc, opENTER) || is(loc, opLEAVE))
+    return i->r == r || i->s == r;
+  return i->r == r;
+}
+
+/* Function isJump returns TRUE if the instruction
+ * at loc may go elsewhere than the next one
+ */
+static int isJump(int loc)
+{ return isBranch(instr[loc].op) || is(loc, opCALL) || is(loc, opRET)
+         || is(loc, opHALT) || writes(loc, pc);
+}
+
+/* Function isDeadAfter returns TRUE if the value
+ * of register r after the instruction at loc is
+ * overwritten before it is read. Only ac to ac3
+ * are followed, and only to the next jump
+ */
+static int isDeadAfter(int loc, int r)
+{ if (r < ac || r > ac3)
+    return FALSE;
+  for (loc = nextKept(loc); loc >= 0; loc = nextKept(loc))
+  { if (reads(loc, r))
+      return FALSE;
+    if (writes(loc, r))
+      return TRUE;
+    if (isJump(loc))
+      return FALSE;
+  }
+  return FALSE;
+}
+
+/* Procedure delete deletes the instruction at loc */
+static void delete(int loc)
+{ instr[loc].kept = FALSE;
+}
+
+/* Function jumpToNext deletes a jump to the
+ * instruction after it
+ */
+static int jumpToNext(int loc)
+{ Instr * i = &instr[loc];
+  int next, to;
+  if (i->target < 0 || !(isBranch(i->op) || (is(loc, opLDA) && i->r == pc)))
+    return FALSE;
+  next = nextKept(loc);
+  for (to = i->target; to < size && !instr[to].kept; to++)
+    ;
+  if (to != (next < 0 ? size : next))
+    return FALSE;
+  delete(loc);
+  return TRUE;
+}
+
+/* Function selfCopy deletes LDA r,0(r) */
+static int selfCopy(int loc)
+{ Instr * i = &instr[loc];
+  if (!is(loc, opLDA) || i->d != 0 || i->r != i->s || i->r == pc)
+    return FALSE;
+  delete(loc);
+  return TRUE;
+}
+
+/* Function storeLoad replaces the load of a word
+ * just stored by a copy of the register stored,
+ * or deletes it if that is the register loaded:
+ * ST r,k(s); LD u,k(s) becomes ST r,k(s); LDA u,0(r)
+ */
+static int storeLoad(int loc)
+{ Instr * a = &instr[loc], * b;
+  int next = nextKept(loc);
+  if (next < 0 || !is(loc, opST) || !is(next, opLD) || isLeader(next))
+    return FALSE;
+  b = &instr[next];
+  if (a->s == pc || b->s != a->s || b->d != a->d)
+    return FALSE;
+  if (b->r == a->r)
+    delete(next);
+  else
+  { b->op = opLDA;
+    b->d = 0;
+    b->s = a->r;
+  }
+  return TRUE;
+}
+
+/* Function constOperand folds a constant loaded
+ * for an addition or subtraction into it:
+ * LDC t,n; ADD r,s,t becomes LDA r,n(s) when t
+ * is not needed after
+ */
+static int constOperand(int loc)
+{ Instr * a = &instr[loc], * b;
+  int next = nextKept(loc), other, n;
+  if (next < 0 || !is(loc, opLDC) || isLeader(next))
+    return FALSE;
+  b = &instr[next];
+  n = a->d;
+  if (is(next, opADD) && b->t == a->r && b->s != a->r)
+    other = b->s;
+  else if (is(next, opADD) && b->s == a->r && b->t != a->r)
+    other = b->t;
+  else if (is(next, opSUB) && b->t == a->r && b->s != a->r)
+  { other = b->s;
+    n = -n;
+  }
+  else
+    return FALSE;
+  if (other == pc || (b->r != a->r && !isDeadAfter(next, a->r)))
+    return FALSE;
+  b->op = opLDA;
+  b->d = n;
+  b->s = other;
+  delete(loc);
+  return TRUE;
+}
+
+/* Function foldAddress folds an address computed
+ * into a register into the displacement of the
+ * access through it: LDA r,n(s); LD u,k(r) becomes
+ * LD u,n+k(s) when r is not needed after. An
+ * address loaded by LDC is taken from gp, which
+ * is always 0
+ */
+static int foldAddress(int loc)
+{ Instr * a = &instr[loc], * b;
+  int next = nextKept(loc), base;
+  if (is(loc, opLDC))
+    base = gp;
+  else if (is(loc, opLDA) && a->s != pc)
+    base = a->s;
+  else
+    return FALSE;
+  if (next < 0 || a->r == pc || isLeader(next))
+    return FALSE;
+  b = &instr[next];
+  if (!(is(next, opLD) || is(next, opST) || is(next, opLDA)) || b->s != a->r)
+    return FALSE;
+  if (is(next, opST) ? b->r == a->r || !isDeadAfter(next, a->r)
+      : b->r != a->r && !isDeadAfter(next, a->r))
+    return FALSE;
+  b->d += a->d;
+  b->s = base;
+  delete(loc);
+  return TRUE;
+}
+
+/* Function reloadConst deletes LDC r,n when r
+ * already holds n on the only path reaching it
+ */
+static int reloadConst(int loc)
+{ Instr * a = &instr[loc];
+  int p;
+  if (!is(loc, opLDC) || isLeader(loc))
+    return FALSE;
+  for (p = prevKept(loc); p >= 0; p = prevKept(p))
+  { if (is(p, opLDC) && instr[p].r == a->r && instr[p].d == a->d)
+    { delete(loc);
+      return TRUE;
+    }
+    if (writes(p, a->r) || isJump(p) || isLeader(p))
+      return FALSE;
+  }
+  return FALSE;
+}
+
+/* Function deadResult deletes an instruction with
+ * no effect but a result that is never read
+ */
+static int deadResult(int loc)
+{ Instr * a = &instr[loc];
+  if (!(is(loc, opLDC) || is(loc, opLDA) || is(loc, opLD) || is(loc, opADD)
+        || is(loc, opSUB) || is(loc, opMUL) || is(loc, opSHL)
+        || is(loc, opSHR)) || (!isRO(a->op) && a->s == pc)
+      || !isDeadAfter(loc, a->r))
+    return FALSE;
+  delete(loc);
+  return TRUE;
+}
+
+/* patterns is the table of patterns, tried in
+   order at each location */
+static Pattern patterns[] =
+   { { "jumps to the next instruction", jumpToNext, 0 },
+     { "self copies", selfCopy, 0 },
+     { "loads of a word just stored", storeLoad, 0 },
+     { "constant operands folded", constOperand, 0 },
+     { "addresses folded", foldAddress, 0 },
+     { "constants reloaded", reloadConst, 0 },
+     { "unused results", deadResult, 0 },
+     { NULL, NULL, 0 }
+   };
+
+/* Function peephole applies the patterns to the
+ * code buffer until none matches and returns the
+ * number of rewrites
+ */
+int peephole(void)
+{ Pattern * p;
+  int loc, changes, total = 0;
+  instr = codeBuffer(&size);
+  isTarget = (char *) realloc(isTarget, size + 1);
+  for (p = patterns; p->name != NULL; p++)
+    p->count = 0;
+  do
+  { changes = 0;
+    findTargets();
+    for (loc = 0; loc < size; loc++)
+      for (p = patterns; p->name != NULL && instr[loc].kept; p++)
+        if (p->apply(loc))
+        { p->count++;
+          changes++;
+        }
+    total += changes;
+  } while (changes > 0);
+  if (TraceOptimize)
+  { fprintf(listing, "\nPeephole:\n");
+    for (p = patterns; p->name != NULL; p++)
+      fprintf(listing, "  %d %s\n", p->count, p->name);
+  }
+  return total;
+}
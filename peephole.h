@@ -0,0 +1,16 @@
+/****************************************************/
+/* File: peephole.h                                 */
+/* Peephole optimization of the TM code for the C-  */
+/* compiler                                         */
+/****************************************************/
+
+#ifndef _PEEPHOLE_H_
+#define _PEEPHOLE_H_
+
+/* Function peephole applies the patterns to the
+ * code buffer until none matches and returns the
+ * number of rewrites
+ */
+int peephole(void);
+
+#endif
@@ -0,0 +1,230 @@
+/****************************************************/
+/* File: profile.c                                  */
+/* Profile-guided optimization for the C- compiler. */
+/* With -fprofile-generate the code generator marks */
+/* the jump of each if and while test and each call */
+/* with a probe, a *@ line in the code file; tm     */
+/* counts the probed instructions and writes their  */
+/* counts to a profile keyed to function and source */
+/* line. With -fprofile-use the profile is read     */
+/* back for the passes to ask                       */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "code.h"
+#include "profile.h"
+
+/* A CountList holds the counts of the profile: for
+ * the if or while test named, the times it held
+ * and failed; for the calls to the function named,
+ * the times they were made, in yes. Tests and
+ * calls copied by passes are all counted under
+ * the line they came from
+ */
+typedef struct countRec
+   { char * function;
+     int lineno;
+     char * name; /* "if", "while" or the callee */
+     int yes, no;
+     struct countRec * next;
+   } * CountList;
+
+static CountList counts = NULL;
+
+/* the largest count of the profile */
+static int maxCount = 0;
+
+/* the functions of the source with a body, in
+   order, and the line each starts on */
+static char ** functionName = NULL;
+static int * functionLine = NULL;
+static int functionCount = 0;
+
+/* A DecisionList holds the decisions the profile
+ * changed, in the order they were made
+ */
+typedef struct decisionRec
+   { int lineno;
+     char * text;
+     struct decisionRec * next;
+   } * DecisionList;
+
+static DecisionList decisions = NULL;
+
+/* Procedure startProfile notes where each function
+ * of the syntax tree starts, so that a source line
+ * can be traced to its function once passes have
+ * moved code between them
+ */
+void startProfile(TreeNode * syntaxTree)
+{ TreeNode * t;
+  int n = 0;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    n++;
+  functionName = (char **) malloc((n + 1) * sizeof(char *));
+  functionLine = (int *) malloc((n + 1) * sizeof(int));
+  functionCount = 0;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+    { functionName[functionCount] = t->attr.name;
+      functionLine[functionCount++] = t->lineno;
+    }
+}
+
+/* Function sourceFunction returns the name of the
+ * function line lineno of the source is in
+ */
+static char * sourceFunction(int lineno)
+{ int k;
+  for (k = functionCount - 1; k > 0; k--)
+    if (functionLine[k] <= lineno)
+      break;
+  return functionCount > 0 ? functionName[k] : "?";
+}
+
+/* Function find returns the counts named name at
+ * lineno of function, or NULL if there are none
+ */
+static CountList find(char * function, int lineno, char * name)
+{ CountList c;
+  for (c = counts; c != NULL; c = c->next)
+    if (c->lineno == lineno && strcmp(c->function, function) == 0
+        && strcmp(c->name, name) == 0)
+      return c;
+  return NULL;
+}
+
+/* Procedure addCount adds yes and no to the counts
+ * named name at lineno of function
+ */
+static void addCount(char * function, int lineno, char * name,
+                     int yes, int no)
+{ CountList c = find(function, lineno, name);
+  if (c == NULL)
+  { c = (CountList) malloc(sizeof(struct countRec));
+    c->function = copyString(function);
+    c->lineno = lineno;
+    c->name = copyString(name);
+    c->yes = 0;
+    c->no = 0;
+    c->next = counts;
+    counts = c;
+  }
+  c->yes += yes;
+  c->no += no;
+  if (c->yes + c->no > maxCount)
+    maxCount = c->yes + c->no;
+}
+
+/* Function readProfile reads the profile tm wrote
+ * to file and returns FALSE if it cannot be read
+ */
+int readProfile(char * file)
+{ FILE * f = fopen(file, "r");
+  char line[256], function[128], name[128];
+  int lineno, yes, no;
+  if (f == NULL)
+    return FALSE;
+  while (fgets(line, sizeof(line), f) != NULL)
+    if (sscanf(line, "branch %127s %d %127s %d %d", function, &lineno,
+               name, &yes, &no) == 5)
+      addCount(function, lineno, name, yes, no);
+    else if (sscanf(line, "call %127s %d %127s %d", function, &lineno,
+                    name, &yes) == 4)
+      addCount(function, lineno, name, yes, 0);
+  fclose(f);
+  return TRUE;
+}
+
+/* Function testKind returns the word naming the
+ * test of if or while statement t in the profile,
+ * which keeps apart an if and a while on one line
+ */
+static char * testKind(TreeNode * t)
+{ return t->kind.stmt == WhileK ? "while" : "if";
+}
+
+/* Procedure probeBranch makes the conditional jump
+ * emitted next count for the test of if or while
+ * statement t, the jump being taken when the
+ * test's truth is sense
+ */
+void probeBranch(TreeNode * t, int sense)
+{ char probe[160];
+  sprintf(probe, "branch %s %d %s %d", sourceFunction(t->lineno), t->lineno,
+          testKind(t), sense);
+  emitProbe(probe);
+}
+
+/* Procedure probeCall makes the call emitted next
+ * count for the call to callee at lineno
+ */
+void probeCall(int lineno, char * callee)
+{ char probe[260];
+  sprintf(probe, "call %s %d %s", sourceFunction(lineno), lineno, callee);
+  emitProbe(probe);
+}
+
+/* Function branchCount sets yes and no to the
+ * times the test of if or while statement t held
+ * and failed, and returns FALSE if the profile
+ * does not have it
+ */
+int branchCount(TreeNode * t, int * yes, int * no)
+{ CountList c = find(sourceFunction(t->lineno), t->lineno, testKind(t));
+  if (c == NULL)
+    return FALSE;
+  *yes = c->yes;
+  *no = c->no;
+  return TRUE;
+}
+
+/* Function callCount returns the times the calls
+ * to callee at lineno were made, or -1 if the
+ * profile does not have them
+ */
+int callCount(int lineno, char * callee)
+{ CountList c = find(sourceFunction(lineno), lineno, callee);
+  return c == NULL ? -1 : c->yes;
+}
+
+/* Function isHot returns TRUE if a branch or call
+ * counted count times is hot
+ */
+int isHot(int count)
+{ return count > 0 && count * HOTFRACTION >= maxCount;
+}
+
+/* Procedure profileDecision records that the
+ * profile changed what a pass did at lineno, as
+ * text says, for reportProfile. A decision made
+ * again, as when code is generated twice, is
+ * recorded once
+ */
+void profileDecision(int lineno, char * text)
+{ DecisionList d, * last = &decisions;
+  for (d = decisions; d != NULL; d = d->next)
+  { if (d->lineno == lineno && strcmp(d->text, text) == 0)
+      return;
+    last = &d->next;
+  }
+  d = (DecisionList) malloc(sizeof(struct decisionRec));
+  d->lineno = lineno;
+  d->text = copyString(text);
+  d->next = NULL;
+  *last = d;
+}
+
+/* Procedure reportProfile lists the decisions the
+ * profile changed to the listing file
+ */
+void reportProfile(void)
+{ DecisionList d;
+  int n = 0;
+  fprintf(listing, "\nProfile decisions:\n");
+  for (d = decisions; d != NULL; d = d->next, n++)
+    fprintf(listing, "  line %d: %s\n", d->lineno, d->text);
+  fprintf(listing, "  %d decisions changed by the profile\n", n);
+}
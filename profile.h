@@ -0,0 +1,68 @@
+/****************************************************/
+/* File: profile.h                                  */
+/* Profile-guided optimization for the C- compiler  */
+/****************************************************/
+
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+/* HOTFRACTION sets what is hot: a branch or call
+ * counted at least 1/HOTFRACTION as often as the
+ * most frequent one in the profile
+ */
+#define HOTFRACTION 100
+
+/* Procedure startProfile notes where each function
+ * of the syntax tree starts, so that a source line
+ * can be traced to its function once passes have
+ * moved code between them
+ */
+void startProfile(TreeNode * syntaxTree);
+
+/* Function readProfile reads the profile tm wrote
+ * to file and returns FALSE if it cannot be read
+ */
+int readProfile(char * file);
+
+/* Procedure probeBranch makes the conditional jump
+ * emitted next count for the test of if or while
+ * statement t, the jump being taken when the
+ * test's truth is sense
+ */
+void probeBranch(TreeNode * t, int sense);
+
+/* Procedure probeCall makes the call emitted next
+ * count for the call to callee at lineno
+ */
+void probeCall(int lineno, char * callee);
+
+/* Function branchCount sets yes and no to the
+ * times the test of if or while statement t held
+ * and failed, and returns FALSE if the profile
+ * does not have it
+ */
+int branchCount(TreeNode * t, int * yes, int * no);
+
+/* Function callCount returns the times the calls
+ * to callee at lineno were made, or -1 if the
+ * profile does not have them
+ */
+int callCount(int lineno, char * callee);
+
+/* Function isHot returns TRUE if a branch or call
+ * counted count times is hot
+ */
+int isHot(int count);
+
+/* Procedure profileDecision records that the
+ * profile changed what a pass did at lineno, as
+ * text says, for reportProfile
+ */
+void profileDecision(int lineno, char * text);
+
+/* Procedure reportProfile lists the decisions the
+ * profile changed to the listing file
+ */
+void reportProfile(void);
+
+#endif
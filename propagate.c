@@ -0,0 +1,339 @@
+/****************************************************/
+/* File: propagate.c                                */
+/* Constant and copy propagation over the syntax    */
+/* tree for the C- compiler: a forward dataflow     */
+/* analysis following the structured control flow   */
+/* of each function, iterated to a fixpoint around  */
+/* loops, then a rewrite of the uses it settles     */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "propagate.h"
+
+/* what is known of a variable at a point: its
+   value is a constant, or equal to another
+   (non-global) variable, or unknown */
+typedef enum {UnknownV,ConstV,CopyV} ValueKind;
+
+/* A State holds what is known of each tracked
+   variable; a state no path reaches knows all */
+typedef struct
+   { int reached;
+     ValueKind * kind;
+     int * val; /* the constant, or the variable copied */
+   } State;
+
+/* the scalars of the function being analysed:
+   its parameters and locals and the globals */
+static Symbol ** varSym = NULL;
+static int varCount = 0;
+static int varMax = 0;
+
+/* rewrite is TRUE on the final pass, when the
+   states are settled and uses are replaced */
+static int rewrite;
+
+/* counts for the report */
+static int constants;
+static int copies;
+
+/* Procedure addVar tracks the scalar with symbol sym */
+static void addVar(Symbol * sym)
+{ if (varCount == varMax)
+  { varMax = varMax == 0 ? 32 : varMax * 2;
+    varSym = (Symbol **) realloc(varSym, varMax * sizeof(Symbol *));
+  }
+  varSym[varCount++] = sym;
+}
+
+/* Procedure addLocals tracks the scalar locals
+ * declared in the blocks of statement list t
+ */
+static void addLocals(TreeNode * t)
+{ TreeNode * p;
+  int i;
+  for (; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK)
+    { if (t->kind.stmt == CompoundK)
+        for (p = t->child[0]; p != NULL; p = p->sibling)
+          if (p->kind.exp == VarK)
+            addVar(p->sym);
+      for (i = 0; i < MAXCHILDREN; i++)
+        addLocals(t->child[i]);
+    }
+}
+
+/* Function varIndex returns the index of the
+ * tracked variable with symbol sym, or -1
+ */
+static int varIndex(Symbol * sym)
+{ int v;
+  for (v = 0; v < varCount; v++)
+    if (varSym[v] == sym)
+      return v;
+  return -1;
+}
+
+static void newState(State * s)
+{ s->reached = TRUE;
+  s->kind = (ValueKind *) malloc(varCount * sizeof(ValueKind) + 1);
+  s->val = (int *) malloc(varCount * sizeof(int) + 1);
+}
+
+static void freeState(State * s)
+{ free(s->kind);
+  free(s->val);
+}
+
+static void copyState(State * d, State * s)
+{ d->reached = s->reached;
+  memcpy(d->kind, s->kind, varCount * sizeof(ValueKind));
+  memcpy(d->val, s->val, varCount * sizeof(int));
+}
+
+/* Function meet merges state s into d, keeping
+ * what both know, and returns TRUE if d changed
+ */
+static int meet(State * d, State * s)
+{ int v, changed = FALSE;
+  if (!s->reached)
+    return FALSE;
+  if (!d->reached)
+  { copyState(d, s);
+    return TRUE;
+  }
+  for (v = 0; v < varCount; v++)
+    if (d->kind[v] != UnknownV
+        && (d->kind[v] != s->kind[v] || d->val[v] != s->val[v]))
+    { d->kind[v] = UnknownV;
+      changed = TRUE;
+    }
+  return changed;
+}
+
+/* Procedure kill forgets variable v and every
+ * variable known to be a copy of it
+ */
+static void kill(State * s, int v)
+{ int u;
+  s->kind[v] = UnknownV;
+  for (u = 0; u < varCount; u++)
+    if (s->kind[u] == CopyV && s->val[u] == v)
+      s->kind[u] = UnknownV;
+}
+
+/* Procedure killGlobals forgets the globals, which
+ * a call may change; array stores are not tracked
+ * and change no scalar
+ */
+static void killGlobals(State * s)
+{ int v;
+  for (v = 0; v < varCount; v++)
+    if (varSym[v]->storage == GlobalS)
+      kill(s, v);
+}
+
+/* Function assigns returns TRUE if expression t
+ * assigns to variable v
+ */
+static int assigns(TreeNode * t, int v)
+{ TreeNode * p;
+  int i;
+  if (t->kind.exp == AssignK && t->child[0]->kind.exp == IdK
+      && varIndex(t->child[0]->sym) == v)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      if (assigns(p, v))
+        return TRUE;
+  return FALSE;
+}
+
+/* Procedure replaceUses rewrites the uses in t
+ * of the variables whose values are known in s.
+ * Within the expression top, variables it
+ * assigns are left alone, as are globals if it
+ * has a call, since the order of evaluation
+ * decides which value such a use sees
+ */
+static void replaceUses(TreeNode * t, TreeNode * top, int call, State * s)
+{ TreeNode * p;
+  int i, v;
+  if (t->kind.exp == IdK)
+  { v = varIndex(t->sym);
+    if (v < 0 || s->kind[v] == UnknownV || assigns(top, v)
+        || (call && varSym[v]->storage == GlobalS))
+      return;
+    if (s->kind[v] == ConstV)
+    { t->kind.exp = ConstK;
+      t->attr.val = s->val[v];
+      t->sym = NULL;
+      constants++;
+    }
+    else if (!assigns(top, s->val[v]))
+    { t->sym = varSym[s->val[v]];
+      t->attr.name = t->sym->name;
+      copies++;
+    }
+    return;
+  }
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      if (t->kind.exp != AssignK || i != 0 || p->kind.exp != IdK)
+        replaceUses(p, top, call, s);
+}
+
+/* Procedure killAssigned forgets the variables
+ * assigned in t
+ */
+static void killAssigned(TreeNode * t, State * s)
+{ TreeNode * p;
+  int i, v;
+  if (t->kind.exp == AssignK && t->child[0]->kind.exp == IdK
+      && (v = varIndex(t->child[0]->sym)) >= 0)
+    kill(s, v);
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      killAssigned(p, s);
+}
+
+/* Procedure propExp rewrites expression t by
+ * state s if this is the final pass, and applies
+ * its effects to s
+ */
+static void propExp(TreeNode * t, State * s)
+{ TreeNode * rhs;
+  int call = hasCall(t);
+  int v, u;
+  if (!s->reached)
+    return;
+  if (rewrite)
+    replaceUses(t, t, call, s);
+  if (call)
+    killGlobals(s);
+  killAssigned(t, s);
+  if (t->kind.exp != AssignK || t->child[0]->kind.exp != IdK
+      || (v = varIndex(t->child[0]->sym)) < 0)
+    return;
+  /* x = c and x = y make x known */
+  rhs = t->child[1];
+  if (rhs->kind.exp == ConstK)
+  { s->kind[v] = ConstV;
+    s->val[v] = rhs->attr.val;
+  }
+  else if (rhs->kind.exp == IdK && (u = varIndex(rhs->sym)) >= 0
+           && u != v && varSym[u]->storage != GlobalS)
+  { s->kind[v] = CopyV;
+    s->val[v] = u;
+  }
+}
+
+static void propStmts(TreeNode * t, State * s);
+
+/* Procedure propStmt applies statement t to state s */
+static void propStmt(TreeNode * t, State * s)
+{ State other, head;
+  TreeNode * p;
+  int v, final = rewrite;
+  if (t->nodekind == ExpK)
+  { propExp(t, s);
+    return;
+  }
+  switch (t->kind.stmt)
+  { case IfK:
+      propExp(t->child[0], s);
+      newState(&other);
+      copyState(&other, s);
+      propStmts(t->child[1], s);
+      propStmts(t->child[2], &other);
+      meet(s, &other);
+      freeState(&other);
+      break;
+    case WhileK:
+      /* the test is reached from the entry and
+         from the end of the body */
+      newState(&head);
+      newState(&other);
+      copyState(&head, s);
+      rewrite = FALSE;
+      do
+      { copyState(&other, &head);
+        propExp(t->child[0], &other);
+        propStmts(t->child[1], &other);
+      } while (meet(&head, &other));
+      if (final)
+      { rewrite = TRUE;
+        copyState(&other, &head);
+        propExp(t->child[0], &other);
+        propStmts(t->child[1], &other);
+        rewrite = FALSE;
+      }
+      /* the loop is left from the test */
+      copyState(s, &head);
+      propExp(t->child[0], s);
+      rewrite = final;
+      freeState(&head);
+      freeState(&other);
+      break;
+    case ReturnK:
+      if (t->child[0] != NULL)
+        propExp(t->child[0], s);
+      s->reached = FALSE;
+      break;
+    case CompoundK:
+      /* locals start out unknown, even in a loop,
+         and are not copied beyond their block */
+      for (p = t->child[0]; p != NULL; p = p->sibling)
+        if ((v = varIndex(p->sym)) >= 0 && s->reached)
+          kill(s, v);
+      propStmts(t->child[1], s);
+      for (p = t->child[0]; p != NULL; p = p->sibling)
+        if ((v = varIndex(p->sym)) >= 0 && s->reached)
+          kill(s, v);
+      break;
+    default:
+      break;
+  }
+}
+
+static void propStmts(TreeNode * t, State * s)
+{ for (; t != NULL; t = t->sibling)
+    propStmt(t, s);
+}
+
+/* Procedure propagateConstants replaces each use
+ * of a scalar variable whose value is a known
+ * constant, or a copy of another local, on every
+ * path reaching the use by that constant or local
+ */
+void propagateConstants(TreeNode * syntaxTree)
+{ TreeNode * t, * p;
+  State s;
+  int globals, v;
+  constants = 0;
+  copies = 0;
+  varCount = 0;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == ExpK && t->kind.exp == VarK)
+      addVar(t->sym);
+  globals = varCount;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+    { varCount = globals;
+      for (p = t->child[0]; p != NULL; p = p->sibling)
+        if (p->kind.exp == SingleParamK && p->sym != NULL)
+          addVar(p->sym);
+      addLocals(t->child[1]);
+      newState(&s);
+      for (v = 0; v < varCount; v++)
+        s.kind[v] = UnknownV;
+      rewrite = TRUE;
+      propStmts(t->child[1], &s);
+      freeState(&s);
+    }
+  if (TraceOptimize)
+    fprintf(listing, "\nPropagation:\n  %d constants, %d copies propagated\n",
+            constants, copies);
+}
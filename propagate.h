@@ -0,0 +1,17 @@
+/****************************************************/
+/* File: propagate.h                                */
+/* Constant and copy propagation over the syntax    */
+/* tree for the C- compiler                         */
+/****************************************************/
+
+#ifndef _PROPAGATE_H_
+#define _PROPAGATE_H_
+
+/* Procedure propagateConstants replaces each use
+ * of a scalar variable whose value is a known
+ * constant, or a copy of another local, on every
+ * path reaching the use by that constant or local
+ */
+void propagateConstants(TreeNode * syntaxTree);
+
+#endif
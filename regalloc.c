@@ -0,0 +1,507 @@
+/****************************************************/
+/* File: regalloc.c                                 */
+/* Register allocation of scalar variables          */
+/* and frame layout for the C- compiler:            */
+/* backward liveness over the syntax tree of a      */
+/* function, then greedy colouring of the           */
+/* interference graph by decreasing use weight;     */
+/* locals that never interfere share frame slots    */
+/****************************************************/
+
+#include "globals.h"
+#include "code.h"
+#include "optimize.h"
+#include "regalloc.h"
+
+/* MAXVARS is the number of scalars of a
+   function considered for registers */
+#define MAXVARS 32
+
+/* a VarSet has bit i set for candidate i */
+typedef unsigned int VarSet;
+
+#define BIT(v) (((VarSet) 1) << (v))
+
+/* the candidates: scalar locals and parameters,
+   identified by their symbol */
+static Symbol * varSym[MAXVARS];
+static int varWeight[MAXVARS];
+static int varReg[MAXVARS];
+static VarSet interfere[MAXVARS];
+static int varCount = 0;
+
+/* variables live on entry to the function */
+static VarSet entryLive = 0;
+
+/* a set of variables kept for a tree node */
+typedef struct NodeLiveRec
+   { TreeNode * node;
+     VarSet live;
+     struct NodeLiveRec * next;
+   } * NodeLive;
+
+/* the variables live after each call */
+static NodeLive callList = NULL;
+
+/* for each block, the variables live on entry
+   to it or assigned in it: those live somewhere
+   inside it */
+static NodeLive blockList = NULL;
+
+/* variables assigned so far in the block being
+   analysed */
+static VarSet assigned = 0;
+
+/* the locals of the function that need frame
+   slots, with the block declaring them and its
+   preorder range: blocks nest exactly when their
+   ranges overlap */
+static Symbol ** slotSym = NULL;
+static TreeNode ** slotBlock;
+static int * slotSize;
+static int * slotFirst;
+static int * slotLast;
+static int * slotBase;
+static int * slotOrder;
+static int slotCount = 0;
+static int slotMax = 0;
+static int blockCount = 0;
+
+/* number of frame slots the locals use */
+static int frameLength = 0;
+
+/* TRUE if locals may share frame slots */
+static int shareFrame = TRUE;
+
+static VarSet liveList(TreeNode * t, VarSet out);
+static VarSet liveExp(TreeNode * t, VarSet out);
+
+/* Function candidate returns the candidate number
+ * of symbol sym, or -1
+ */
+static int candidate(Symbol * sym)
+{ int v;
+  for (v = 0; v < varCount; v++)
+    if (varSym[v] == sym)
+      return v;
+  return -1;
+}
+
+/* Procedure addCandidates makes candidates of the
+ * scalars in a declaration or parameter list
+ */
+static void addCandidates(TreeNode * t)
+{ for (; t != NULL; t = t->sibling)
+    if ((t->kind.exp == VarK || t->kind.exp == SingleParamK)
+        && t->sym != NULL && varCount < MAXVARS)
+    { varSym[varCount] = t->sym;
+      varWeight[varCount] = 0;
+      varReg[varCount] = -1;
+      interfere[varCount] = 0;
+      varCount++;
+    }
+}
+
+/* Procedure collect finds the candidates
+ * declared in the blocks of a statement list
+ */
+static void collect(TreeNode * t)
+{ int i;
+  for (; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK)
+    { if (t->kind.stmt == CompoundK)
+        addCandidates(t->child[0]);
+      for (i = 0; i < MAXCHILDREN; i++)
+        collect(t->child[i]);
+    }
+}
+
+/* Procedure weigh adds to each candidate its
+ * number of uses, weighted by loop nesting
+ */
+static void weigh(TreeNode * t, int weight)
+{ int i, v;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK && t->kind.exp == IdK)
+    { v = candidate(t->sym);
+      if (v >= 0)
+        varWeight[v] += weight;
+    }
+    for (i = 0; i < MAXCHILDREN; i++)
+      if (t->nodekind == StmtK && t->kind.stmt == WhileK && weight < 4096)
+        weigh(t->child[i], weight * 8);
+      else
+        weigh(t->child[i], weight);
+  }
+}
+
+/* Procedure defines records that candidate v is
+ * assigned while the variables in live are live
+ */
+static void defines(int v, VarSet live)
+{ int w;
+  for (w = 0; w < varCount; w++)
+    if (w != v && (live & BIT(w)))
+    { interfere[v] |= BIT(w);
+      interfere[w] |= BIT(v);
+    }
+}
+
+/* Procedure record adds live to the set kept
+ * for node t in list
+ */
+static void record(NodeLive * list, TreeNode * t, VarSet live)
+{ NodeLive c;
+  for (c = *list; c != NULL; c = c->next)
+    if (c->node == t)
+    { c->live |= live;
+      return;
+    }
+  c = (NodeLive) malloc(sizeof(struct NodeLiveRec));
+  c->node = t;
+  c->live = live;
+  c->next = *list;
+  *list = c;
+}
+
+/* Function recorded returns the set kept for
+ * node t in list
+ */
+static VarSet recorded(NodeLive list, TreeNode * t)
+{ for (; list != NULL; list = list->next)
+    if (list->node == t)
+      return list->live;
+  return 0;
+}
+
+/* Procedure clear empties list */
+static void clear(NodeLive * list)
+{ NodeLive c;
+  while (*list != NULL)
+  { c = *list;
+    *list = c->next;
+    free(c);
+  }
+}
+
+/* Function liveExp returns the variables live
+ * before expression t given those live after it.
+ * Arguments are evaluated last to first
+ */
+static VarSet liveExp(TreeNode * t, VarSet out)
+{ TreeNode * p;
+  int v;
+  if (t == NULL)
+    return out;
+  switch (t->kind.exp)
+  { case IdK:
+      v = candidate(t->sym);
+      return v >= 0 ? out | BIT(v) : out;
+    case IdArrayK:
+      return liveExp(t->child[0], out);
+    case OpK:
+      return liveExp(t->child[0], liveExp(t->child[1], out));
+    case AssignK:
+      if (t->child[0]->kind.exp == IdArrayK)
+        return liveExp(t->child[1], liveExp(t->child[0]->child[0], out));
+      v = candidate(t->child[0]->sym);
+      if (v >= 0)
+      { out &= ~BIT(v);
+        defines(v, out);
+        assigned |= BIT(v);
+      }
+      return liveExp(t->child[1], out);
+    case CallK:
+      record(&callList, t, out);
+      for (p = t->child[0]; p != NULL; p = p->sibling)
+        out = liveExp(p, out);
+      return out;
+    default:
+      return out;
+  }
+}
+
+/* Function liveStmt returns the variables live
+ * before statement t given those live after it
+ */
+static VarSet liveStmt(TreeNode * t, VarSet out)
+{ VarSet in, prev, body, outer;
+  if (t->nodekind == ExpK)
+    return liveExp(t, out);
+  switch (t->kind.stmt)
+  { case CompoundK:
+      outer = assigned;
+      assigned = 0;
+      in = liveList(t->child[1], out);
+      record(&blockList, t, in | assigned);
+      assigned |= outer;
+      return in;
+    case IfK:
+      return liveExp(t->child[0], liveList(t->child[1], out)
+                                  | liveList(t->child[2], out));
+    case WhileK:
+      in = liveExp(t->child[0], out);
+      do
+      { prev = in;
+        body = liveList(t->child[1], in);
+        in = liveExp(t->child[0], out | body);
+      } while (in != prev);
+      return in;
+    case ReturnK:
+      return liveExp(t->child[0], 0);
+    default:
+      return out;
+  }
+}
+
+/* Function liveList returns the variables live
+ * before a statement list
+ */
+static VarSet liveList(TreeNode * t, VarSet out)
+{ if (t == NULL)
+    return out;
+  return liveStmt(t, liveList(t->sibling, out));
+}
+
+/* Procedure colour gives registers to the
+ * candidates by decreasing weight, avoiding
+ * those of interfering variables
+ */
+static void colour(void)
+{ int done[MAXVARS];
+  int i, v, w, best, r;
+  for (v = 0; v < varCount; v++)
+    done[v] = FALSE;
+  for (i = 0; i < varCount; i++)
+  { best = -1;
+    for (v = 0; v < varCount; v++)
+      if (!done[v] && (best < 0 || varWeight[v] > varWeight[best]))
+        best = v;
+    done[best] = TRUE;
+    /* a single use does not pay for a register */
+    if (varWeight[best] < 2)
+      continue;
+    for (r = pc - 1; r >= 0 && varReg[best] < 0; r--)
+    { if (!(VARREGS & (1 << r)))
+        continue;
+      for (w = 0; w < varCount; w++)
+        if ((interfere[best] & BIT(w)) && varReg[w] == r)
+          break;
+      if (w == varCount)
+        varReg[best] = r;
+    }
+  }
+}
+
+/* Function needsSlot returns TRUE if the scalar
+ * candidate v needs a frame slot: it lives in
+ * memory or is saved there across a call
+ */
+static int needsSlot(int v)
+{ NodeLive c;
+  if (v < 0 || varReg[v] < 0)
+    return TRUE;
+  for (c = callList; c != NULL; c = c->next)
+    if (c->live & BIT(v))
+      return TRUE;
+  return FALSE;
+}
+
+/* Procedure addSlots records the locals of each
+ * block under statement list t that need a
+ * frame slot
+ */
+static void addSlots(TreeNode * t)
+{ TreeNode * p;
+  int first, i;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind != StmtK)
+      continue;
+    if (t->kind.stmt == CompoundK)
+    { first = blockCount++;
+      i = slotCount;
+      for (p = t->child[0]; p != NULL; p = p->sibling)
+      { if (p->kind.exp == VarK && !needsSlot(candidate(p->sym)))
+          continue;
+        if (slotCount == slotMax)
+        { slotMax = slotMax == 0 ? 32 : slotMax * 2;
+          slotSym = (Symbol **) realloc(slotSym, slotMax * sizeof(Symbol *));
+          slotBlock = (TreeNode **) realloc(slotBlock, slotMax * sizeof(TreeNode *));
+          slotSize = (int *) realloc(slotSize, slotMax * sizeof(int));
+          slotFirst = (int *) realloc(slotFirst, slotMax * sizeof(int));
+          slotLast = (int *) realloc(slotLast, slotMax * sizeof(int));
+          slotBase = (int *) realloc(slotBase, slotMax * sizeof(int));
+          slotOrder = (int *) realloc(slotOrder, slotMax * sizeof(int));
+        }
+        slotSym[slotCount] = p->sym;
+        slotBlock[slotCount] = t;
+        slotSize[slotCount] = p->sym->size;
+        slotFirst[slotCount] = first;
+        slotCount++;
+      }
+      addSlots(t->child[1]);
+      for (; i < slotCount; i++)
+        slotLast[i] = blockCount;
+    }
+    else
+    { addSlots(t->child[0]);
+      addSlots(t->child[1]);
+      addSlots(t->child[2]);
+    }
+  }
+}
+
+/* Function slotsConflict returns TRUE if locals
+ * i and j may be live at the same time: their
+ * blocks nest and liveness says so. An array is
+ * taken to be live all through its block
+ */
+static int slotsConflict(int i, int j)
+{ int v, w;
+  if (!shareFrame)
+    return TRUE;
+  if (slotLast[i] <= slotFirst[j] || slotLast[j] <= slotFirst[i])
+    return FALSE;
+  v = candidate(slotSym[i]);
+  w = candidate(slotSym[j]);
+  if (v >= 0 && w >= 0)
+    return (interfere[v] & BIT(w)) != 0;
+  if (v >= 0 && slotFirst[i] <= slotFirst[j])
+    return (recorded(blockList, slotBlock[j]) & BIT(v)) != 0;
+  if (w >= 0 && slotFirst[j] <= slotFirst[i])
+    return (recorded(blockList, slotBlock[i]) & BIT(w)) != 0;
+  return TRUE;
+}
+
+/* Procedure layFrame places the locals in the
+ * frame, largest first, each at the lowest
+ * depth free of the locals it conflicts with
+ */
+static void layFrame(void)
+{ int * order = slotOrder;
+  int n, i, j, k, b, base, ok;
+  frameLength = 0;
+  n = 0;
+  for (i = 0; i < slotCount; i++)
+    slotBase[i] = -1;
+  while (n < slotCount)
+  { k = -1;
+    for (i = 0; i < slotCount; i++)
+      if (slotBase[i] < 0 && (k < 0 || slotSize[i] > slotSize[k]))
+        k = i;
+    /* try depth 0 and the depth just past each
+       conflicting local already placed */
+    base = -1;
+    for (j = -1; j < n; j++)
+    { if (j >= 0 && !slotsConflict(k, order[j]))
+        continue;
+      b = j < 0 ? 0 : slotBase[order[j]] + slotSize[order[j]];
+      if (base >= 0 && b >= base)
+        continue;
+      ok = TRUE;
+      for (i = 0; i < n && ok; i++)
+        if (slotsConflict(k, order[i])
+            && b < slotBase[order[i]] + slotSize[order[i]]
+            && slotBase[order[i]] < b + slotSize[k])
+          ok = FALSE;
+      if (ok)
+        base = b;
+    }
+    slotBase[k] = base;
+    slotSym[k]->offset = -(base + slotSize[k]);
+    order[n++] = k;
+    if (base + slotSize[k] > frameLength)
+      frameLength = base + slotSize[k];
+  }
+}
+
+/* Procedure allocRegisters runs liveness analysis
+ * over function tree, colours its most used
+ * scalar locals and parameters with VARREGS and
+ * sets the frame offsets of its locals. The
+ * regalloc and share-frame passes turn the
+ * colouring and the sharing of slots on
+ */
+void allocRegisters(TreeNode * tree)
+{ VarSet params = 0;
+  int v;
+  clear(&callList);
+  clear(&blockList);
+  assigned = 0;
+  varCount = 0;
+  addCandidates(tree->child[0]);
+  for (v = 0; v < varCount; v++)
+    params |= BIT(v);
+  collect(tree->child[1]);
+  weigh(tree->child[1], 1);
+  entryLive = liveList(tree->child[1], 0);
+  /* parameters are all assigned on entry */
+  for (v = 0; v < varCount; v++)
+    if (params & BIT(v))
+      defines(v, entryLive | params);
+  if (passEnabled("regalloc"))
+    colour();
+  shareFrame = passEnabled("share-frame");
+  slotCount = 0;
+  blockCount = 0;
+  addSlots(tree->child[1]);
+  layFrame();
+}
+
+/* Function varRegister returns the register that
+ * holds the variable with symbol sym, or -1 if
+ * it lives in memory
+ */
+int varRegister(Symbol * sym)
+{ int v = candidate(sym);
+  return v >= 0 ? varReg[v] : -1;
+}
+
+/* Function varRegisters returns the set of
+ * registers used by the function's variables
+ */
+int varRegisters(void)
+{ int v, regs = 0;
+  for (v = 0; v < varCount; v++)
+    if (varReg[v] >= 0)
+      regs |= 1 << varReg[v];
+  return regs;
+}
+
+/* Function liveAtEntry returns TRUE if the
+ * variable with symbol sym is live on entry
+ * to the function
+ */
+int liveAtEntry(Symbol * sym)
+{ int v = candidate(sym);
+  return v >= 0 && (entryLive & BIT(v)) != 0;
+}
+
+/* Function liveAcrossCall stores in syms the
+ * register variables whose values are needed
+ * after call node tree, at most NVARREGS, and
+ * returns their number
+ */
+int liveAcrossCall(TreeNode * tree, Symbol ** syms)
+{ NodeLive c;
+  int v, n = 0, regs = 0;
+  for (c = callList; c != NULL; c = c->next)
+    if (c->node == tree)
+      break;
+  if (c == NULL)
+    return 0;
+  for (v = 0; v < varCount; v++)
+    if ((c->live & BIT(v)) && varReg[v] >= 0
+        && !(regs & (1 << varReg[v])))
+    { regs |= 1 << varReg[v];
+      syms[n++] = varSym[v];
+    }
+  return n;
+}
+
+/* Function frameSlots returns the number of
+ * frame slots the function's locals need
+ */
+int frameSlots(void)
+{ return frameLength;
+}
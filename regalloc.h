@@ -0,0 +1,55 @@
+/****************************************************/
+/* File: regalloc.h                                 */
+/* Register allocation of scalar variables          */
+/* and frame layout for the C- compiler             */
+/****************************************************/
+
+#ifndef _REGALLOC_H_
+#define _REGALLOC_H_
+
+/* VARREGS is the set of registers variables may
+ * be kept in; cgen uses the rest of them for
+ * expression temporaries
+ */
+#define VARREGS ((1 << ac2) | (1 << ac3))
+
+/* NVARREGS is the number of registers in VARREGS */
+#define NVARREGS 2
+
+/* Procedure allocRegisters runs liveness analysis
+ * over function tree, colours its most used
+ * scalar locals and parameters with VARREGS and
+ * sets the frame offsets of its locals
+ */
+void allocRegisters(TreeNode * tree);
+
+/* Function varRegister returns the register that
+ * holds the variable with symbol sym, or -1 if
+ * it lives in memory
+ */
+int varRegister(Symbol * sym);
+
+/* Function varRegisters returns the set of
+ * registers used by the function's variables
+ */
+int varRegisters(void);
+
+/* Function liveAtEntry returns TRUE if the
+ * variable with symbol sym is live on entry
+ * to the function
+ */
+int liveAtEntry(Symbol * sym);
+
+/* Function liveAcrossCall stores in syms the
+ * register variables whose values are needed
+ * after call node tree, at most NVARREGS, and
+ * returns their number
+ */
+int liveAcrossCall(TreeNode * tree, Symbol ** syms);
+
+/* Function frameSlots returns the number of
+ * frame slots the function's locals need
+ */
+int frameSlots(void);
+
+#endif
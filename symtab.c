@@ -84,6 +84,7 @@ void st_insert_( ScopeList scope, char * name, ExpType type, int lineno, int loc
     l->lines->next = NULL;
     l->next = scope->bucket[h];
     l->isArray = isArray;
+    l->sym = NULL;
     scope->bucket[h] = l; }
   else /* found in table, so just add line number */
   { LineList t = l->lines;
@@ -33,6 +33,7 @@ typedef struct BucketListRec
      int isArray;
      LineList lines;
      int memloc ; /* memory location for variable */
+     Symbol * sym; /* resolved declaration */
      struct BucketListRec * next;
    } * BucketList;
 
@@ -0,0 +1,129 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_input, @function
+cm_input:
+	subq	$24, %rsp
+	leaq	.Lformat_in(%rip), %rdi
+	leaq	12(%rsp), %rsi
+	xorl	%eax, %eax
+	call	scanf@PLT
+	cmpl	$1, %eax
+	jne	.Lbad_input
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	ret
+.Lbad_input:
+	movl	$1, %edi
+	call	exit@PLT
+	.type	cm_f, @function
+cm_f:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$64, %rsp
+	movl	%edi, -4(%rbp)
+.Lf_0:
+	movl	-4(%rbp), %eax
+	testl	%eax, %eax
+	jne	.Lf_2
+.Lf_1:
+	movl	$0, %eax
+	leave
+	ret
+.Lf_2:
+	movl	-4(%rbp), %eax
+	imull	$2, %eax
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %eax
+	subl	-4(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %eax
+	imull	$3, %eax
+	movl	%eax, -20(%rbp)
+	movl	-12(%rbp), %eax
+	imull	-20(%rbp), %eax
+	movl	%eax, -24(%rbp)
+	movl	-24(%rbp), %eax
+	subl	-4(%rbp), %eax
+	movl	%eax, -28(%rbp)
+	movl	-4(%rbp), %eax
+	subl	$1, %eax
+	movl	%eax, -32(%rbp)
+	movl	-32(%rbp), %edi
+	call	cm_f
+	movl	%eax, -36(%rbp)
+	movl	-36(%rbp), %eax
+	addl	-28(%rbp), %eax
+	movl	%eax, -40(%rbp)
+	movl	-12(%rbp), %eax
+	imull	-20(%rbp), %eax
+	movl	%eax, -44(%rbp)
+	movl	-40(%rbp), %eax
+	subl	-44(%rbp), %eax
+	movl	%eax, -48(%rbp)
+	movl	-4(%rbp), %eax
+	imull	$2, %eax
+	movl	%eax, -52(%rbp)
+	movl	-48(%rbp), %eax
+	addl	-52(%rbp), %eax
+	movl	%eax, -56(%rbp)
+	movl	-56(%rbp), %eax
+	leave
+	ret
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+.Lmain_0:
+	movl	$7, %eax
+	movl	%eax, 0(%rbx)
+	call	cm_input
+	movl	%eax, -4(%rbp)
+	movl	-4(%rbp), %edi
+	call	cm_f
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %edi
+	call	cm_output
+	movl	0(%rbx), %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %edi
+	call	cm_output
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,171 @@
+* TINY Compilation to TM Code
+* File: out/deep.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,42(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration input
+  7:     IN  0,0,0 	read integer value
+  8:    RET  6,0(0) 	return and pop arguments
+* <- function declaration input end
+* -> function declaration f
+  9:  ENTER  4,3(6) 	push fp and allocate frame
+* register 3 holds n
+ 10:     LD  3,2(4) 	load parameter into register
+* -> compound 11 start
+* register 2 holds a
+* b is at -2(fp)
+* c is at -3(fp)
+* -> if start
+* -> condition
+* <- condition
+ 11:    JNE  3,3(7) 	if: jmp to else
+* -> const 0
+ 12:    LDC  0,0(0) 	load const
+* <- Const end
+ 13:  LEAVE  4,0(6) 	return: pop frame and fp
+ 14:    RET  6,1(0) 	return and pop arguments
+* <- if end
+* -> assign to a
+* -> generate code for rhs in place
+* -> Op
+* -> Op
+ 15:    SHL  2,1(3) 	op * by shift
+* <- Op
+ 16:    LDA  2,1(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to b
+* -> generate code for rhs
+* -> Op
+* -> Op
+ 17:    SUB  0,2,3 	op -
+* <- Op
+ 18:    LDC  1,3(0) 	load const operand
+ 19:    MUL  0,0,1 	op *
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 20:     ST  0,-2(4) 	assign: store value
+* <- store value end
+* <- assign
+* -> assign to c
+* -> generate code for rhs
+* -> Op
+* -> Op
+* -> Id
+* <- Id
+ 21:    MUL  0,2,0 	op *
+* <- Op
+ 22:    SUB  0,0,3 	op -
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 23:     ST  0,-3(4) 	assign: store value
+* <- store value end
+* <- assign
+* -> Op
+* -> left
+* -> Op
+* -> left
+* -> Op
+* -> left
+* -> call function f
+* -> Op
+ 24:    LDA  0,-1(3) 	op +/- const
+* <- Op
+ 25:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 26:     ST  3,2(4) 	save register variable
+ 27:     ST  2,-1(4) 	save register variable
+ 28:    LDA  6,-1(6) 	stack growth after push arguments
+ 29:   CALL  6,-21(7) 	push return address and jump
+ 30:     LD  3,2(4) 	restore register variable
+ 31:     LD  2,-1(4) 	restore register variable
+* <- call function f end
+* <- left
+* -> right
+* -> Id
+ 32:     LD  1,-3(4) 	id: load value
+* <- Id
+* <- right
+ 33:    ADD  0,0,1 	op +
+* <- Op
+* <- left
+ 34:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> Op
+* -> Id
+ 35:     LD  0,-2(4) 	id: load value
+* <- Id
+ 36:    MUL  0,2,0 	op *
+* <- Op
+* <- right
+ 37:     LD  1,-1(6) 	op: reload operand
+ 38:    SUB  0,1,0 	op -
+* <- Op
+* <- left
+ 39:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> Op
+ 40:    SHL  0,1(3) 	op * by shift
+* <- Op
+* <- right
+ 41:     LD  1,-1(6) 	op: reload operand
+ 42:    ADD  0,1,0 	op +
+* <- Op
+ 43:  LEAVE  4,0(6) 	return: pop frame and fp
+ 44:    RET  6,1(0) 	return and pop arguments
+* <- compound 11 end
+* <- function declaration f end
+* -> function declaration main
+ 45:  ENTER  4,0(6) 	push fp and allocate frame
+* -> compound 16 start
+* -> assign to g
+* -> generate code for rhs
+* -> const 7
+ 46:    LDC  0,7(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+ 47:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* -> call function output
+* -> call function f
+* -> call function input
+* 0 arguments are pushed
+ 48:   CALL  6,-42(7) 	push return address and jump
+* <- call function input end
+ 49:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 50:    LDA  6,-1(6) 	stack growth after push arguments
+ 51:   CALL  6,-43(7) 	push return address and jump
+* <- call function f end
+ 52:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 53:    LDA  6,-1(6) 	stack growth after push arguments
+ 54:   CALL  6,-51(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> Id
+ 55:     LD  0,0(5) 	id: load value
+* <- Id
+ 56:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 57:    LDA  6,-1(6) 	stack growth after push arguments
+ 58:   CALL  6,-55(7) 	push return address and jump
+* <- call function output end
+* <- compound 16 end
+ 59:  LEAVE  4,0(6) 	return: pop frame and fp
+ 60:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
@@ -0,0 +1,100 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_input, @function
+cm_input:
+	subq	$24, %rsp
+	leaq	.Lformat_in(%rip), %rdi
+	leaq	12(%rsp), %rsi
+	xorl	%eax, %eax
+	call	scanf@PLT
+	cmpl	$1, %eax
+	jne	.Lbad_input
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	ret
+.Lbad_input:
+	movl	$1, %edi
+	call	exit@PLT
+	.type	cm_gcd, @function
+cm_gcd:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+.Lgcd_0:
+	movl	-8(%rbp), %eax
+	testl	%eax, %eax
+	jne	.Lgcd_2
+.Lgcd_1:
+	movl	-4(%rbp), %eax
+	leave
+	ret
+.Lgcd_2:
+	movl	-4(%rbp), %eax
+	movl	-8(%rbp), %ecx
+	cltd
+	idivl	%ecx
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %eax
+	imull	-8(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-4(%rbp), %eax
+	subl	-16(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	movl	-8(%rbp), %edi
+	movl	-20(%rbp), %esi
+	leave
+	jmp	cm_gcd
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+.Lmain_0:
+	call	cm_input
+	movl	%eax, -4(%rbp)
+	call	cm_input
+	movl	%eax, -8(%rbp)
+	movl	-4(%rbp), %edi
+	movl	-8(%rbp), %esi
+	call	cm_gcd
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %edi
+	call	cm_output
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
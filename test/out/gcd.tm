@@ -0,0 +1,90 @@
+* TINY Compilation to TM Code
+* File: out/gcd.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,20(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration input
+  7:     IN  0,0,0 	read integer value
+  8:    RET  6,0(0) 	return and pop arguments
+* <- function declaration input end
+* -> function declaration gcd
+  9:  ENTER  4,0(6) 	push fp and allocate frame
+* register 2 holds u
+ 10:     LD  2,2(4) 	load parameter into register
+* register 3 holds v
+ 11:     LD  3,3(4) 	load parameter into register
+* -> compound 8 start
+* -> if start
+* -> condition
+* <- condition
+ 12:    JNE  3,3(7) 	if: jmp to else
+* -> Id
+ 13:    LDA  0,0(2) 	id: copy register
+* <- Id
+ 14:  LEAVE  4,0(6) 	return: pop frame and fp
+ 15:    RET  6,2(0) 	return and pop arguments
+* -> tail call function gcd
+ 16:     ST  3,2(4) 	tail call: store argument
+* -> Op
+ 17:    MOD  0,2,3 	op %
+* <- Op
+ 18:     ST  0,3(4) 	tail call: store argument
+ 19:  LEAVE  4,0(6) 	tail call: pop frame and fp
+ 20:    LDA  7,-12(7) 	tail call: jump to function
+* <- tail call function gcd end
+* <- if end
+* <- compound 8 end
+ 21:  LEAVE  4,0(6) 	return: pop frame and fp
+ 22:    RET  6,2(0) 	return and pop arguments
+* <- function declaration gcd end
+* -> function declaration main
+ 23:  ENTER  4,1(6) 	push fp and allocate frame
+* -> compound 14 start
+* register 3 holds x
+* register 2 holds y
+* -> assign to x
+* -> generate code for rhs in place
+* -> call function input
+* 0 arguments are pushed
+ 24:   CALL  6,-18(7) 	push return address and jump
+ 25:    LDA  3,0(0) 	move return value
+* <- call function input end
+* <- generate code for rhs end
+* <- assign
+* -> assign to y
+* -> generate code for rhs in place
+* -> call function input
+* 0 arguments are pushed
+ 26:     ST  3,-1(4) 	save register variable
+ 27:   CALL  6,-21(7) 	push return address and jump
+ 28:     LD  3,-1(4) 	restore register variable
+ 29:    LDA  2,0(0) 	move return value
+* <- call function input end
+* <- generate code for rhs end
+* <- assign
+* -> call function output
+* -> call function gcd
+ 30:     ST  2,-1(6) 	op: push argument(reverse order)
+ 31:     ST  3,-2(6) 	op: push argument(reverse order)
+* 2 arguments are pushed
+ 32:    LDA  6,-2(6) 	stack growth after push arguments
+ 33:   CALL  6,-25(7) 	push return address and jump
+* <- call function gcd end
+ 34:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 35:    LDA  6,-1(6) 	stack growth after push arguments
+ 36:   CALL  6,-33(7) 	push return address and jump
+* <- call function output end
+* <- compound 14 end
+ 37:  LEAVE  4,0(6) 	return: pop frame and fp
+ 38:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
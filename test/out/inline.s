@@ -0,0 +1,396 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_input, @function
+cm_input:
+	subq	$24, %rsp
+	leaq	.Lformat_in(%rip), %rdi
+	leaq	12(%rsp), %rsi
+	xorl	%eax, %eax
+	call	scanf@PLT
+	cmpl	$1, %eax
+	jne	.Lbad_input
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	ret
+.Lbad_input:
+	movl	$1, %edi
+	call	exit@PLT
+	.type	cm_set, @function
+cm_set:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	movl	%edx, -12(%rbp)
+.Lset_0:
+	movl	-4(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-12(%rbp), %eax
+	movslq	-16(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	movl	0(%rbx), %eax
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -24(%rbp)
+	movl	-24(%rbp), %eax
+	movl	%eax, 0(%rbx)
+	leave
+	ret
+	.type	cm_dot, @function
+cm_dot:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	movl	%edx, -12(%rbp)
+.Ldot_0:
+	movl	$0, %eax
+	movl	%eax, -16(%rbp)
+	movl	$0, %eax
+	movl	%eax, -20(%rbp)
+	jmp	.Ldot_2
+.Ldot_1:
+	movl	-4(%rbp), %eax
+	addl	-16(%rbp), %eax
+	movl	%eax, -24(%rbp)
+	movslq	-24(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -28(%rbp)
+	movl	-8(%rbp), %eax
+	addl	-16(%rbp), %eax
+	movl	%eax, -32(%rbp)
+	movslq	-32(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -36(%rbp)
+	movl	-28(%rbp), %eax
+	imull	-36(%rbp), %eax
+	movl	%eax, -40(%rbp)
+	movl	-20(%rbp), %eax
+	addl	-40(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	movl	-16(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -16(%rbp)
+.Ldot_2:
+	movl	-16(%rbp), %eax
+	subl	-12(%rbp), %eax
+	testl	%eax, %eax
+	jl	.Ldot_1
+.Ldot_3:
+	movl	-20(%rbp), %eax
+	leave
+	ret
+	.type	cm_clamp, @function
+cm_clamp:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+.Lclamp_0:
+	movl	-4(%rbp), %eax
+	subl	-8(%rbp), %eax
+	testl	%eax, %eax
+	jle	.Lclamp_2
+.Lclamp_1:
+	movl	-8(%rbp), %eax
+	movl	%eax, -4(%rbp)
+.Lclamp_2:
+	movl	-4(%rbp), %eax
+	leave
+	ret
+	.type	cm_bump, @function
+cm_bump:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+.Lbump_0:
+	movl	0(%rbx), %eax
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %eax
+	addl	-4(%rbp), %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %eax
+	movl	%eax, 0(%rbx)
+	movl	0(%rbx), %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %eax
+	leave
+	ret
+	.type	cm_sq, @function
+cm_sq:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+.Lsq_0:
+	movl	-4(%rbp), %eax
+	imull	-4(%rbp), %eax
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %eax
+	leave
+	ret
+	.type	cm_twice, @function
+cm_twice:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+.Ltwice_0:
+	movl	-4(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -12(%rbp)
+	movslq	-12(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %eax
+	addl	-16(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %eax
+	leave
+	ret
+	.type	cm_show, @function
+cm_show:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+.Lshow_0:
+	movl	-4(%rbp), %edi
+	call	cm_output
+	leave
+	ret
+	.type	cm_pick, @function
+cm_pick:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+.Lpick_0:
+	movl	-4(%rbp), %eax
+	subl	-8(%rbp), %eax
+	testl	%eax, %eax
+	jle	.Lpick_2
+.Lpick_1:
+	movl	-4(%rbp), %eax
+	leave
+	ret
+.Lpick_2:
+	movl	-8(%rbp), %eax
+	leave
+	ret
+	.type	cm_chain, @function
+cm_chain:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+.Lchain_0:
+	movl	$1, %eax
+	movl	%eax, -8(%rbp)
+	movl	-4(%rbp), %edi
+	movl	-8(%rbp), %esi
+	movl	$3, %edx
+	leave
+	jmp	cm_dot
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$128, %rsp
+	subq	$3, %r12
+.Lmain_0:
+	movl	$0, %eax
+	movl	%eax, 0(%rbx)
+	leal	0(%r12), %eax
+	movl	%eax, -4(%rbp)
+	movl	-4(%rbp), %edi
+	movl	$0, %esi
+	movl	$2, %edx
+	call	cm_set
+	leal	0(%r12), %eax
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %edi
+	movl	$1, %esi
+	movl	$3, %edx
+	call	cm_set
+	leal	0(%r12), %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %edi
+	movl	$2, %esi
+	movl	$4, %edx
+	call	cm_set
+	movl	$1, %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %edi
+	movl	$0, %esi
+	movl	$1, %edx
+	call	cm_set
+	movl	$1, %eax
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %edi
+	movl	$1, %esi
+	movl	$1, %edx
+	call	cm_set
+	movl	$1, %eax
+	movl	%eax, -24(%rbp)
+	movl	-24(%rbp), %edi
+	movl	$2, %esi
+	movl	$10, %edx
+	call	cm_set
+	movl	0(%rbx), %eax
+	movl	%eax, -28(%rbp)
+	movl	-28(%rbp), %edi
+	call	cm_output
+	movl	$1, %eax
+	movl	%eax, -32(%rbp)
+	leal	0(%r12), %eax
+	movl	%eax, -36(%rbp)
+	movl	-36(%rbp), %edi
+	movl	-32(%rbp), %esi
+	movl	$3, %edx
+	call	cm_dot
+	movl	%eax, -40(%rbp)
+	movl	-40(%rbp), %edi
+	call	cm_output
+	movl	-40(%rbp), %edi
+	movl	$30, %esi
+	call	cm_clamp
+	movl	%eax, -44(%rbp)
+	movl	-44(%rbp), %edi
+	call	cm_show
+	movl	$100, %edi
+	call	cm_bump
+	movl	%eax, -48(%rbp)
+	movl	$5, %edi
+	call	cm_bump
+	movl	%eax, -52(%rbp)
+	movl	-52(%rbp), %edi
+	movl	-48(%rbp), %esi
+	call	cm_clamp
+	movl	%eax, -40(%rbp)
+	movl	-40(%rbp), %edi
+	call	cm_output
+	movl	0(%rbx), %eax
+	movl	%eax, -56(%rbp)
+	movl	-56(%rbp), %edi
+	call	cm_output
+	movl	-40(%rbp), %eax
+	subl	$100, %eax
+	movl	%eax, -60(%rbp)
+	movl	-60(%rbp), %edi
+	call	cm_sq
+	movl	%eax, -64(%rbp)
+	movl	$3, %edi
+	call	cm_sq
+	movl	%eax, -68(%rbp)
+	movl	-64(%rbp), %eax
+	addl	-68(%rbp), %eax
+	movl	%eax, -72(%rbp)
+	movl	-72(%rbp), %edi
+	call	cm_output
+	leal	0(%r12), %eax
+	movl	%eax, -76(%rbp)
+	movl	-76(%rbp), %edi
+	movl	$1, %esi
+	call	cm_twice
+	movl	%eax, -80(%rbp)
+	movl	-80(%rbp), %edi
+	call	cm_output
+	movl	-44(%rbp), %edi
+	call	cm_sq
+	movl	%eax, -84(%rbp)
+	movl	-84(%rbp), %edi
+	call	cm_show
+	movl	-40(%rbp), %edi
+	movl	$7, %esi
+	call	cm_pick
+	movl	%eax, -88(%rbp)
+	leal	0(%r12), %eax
+	movl	%eax, -92(%rbp)
+	movl	-88(%rbp), %eax
+	movslq	-92(%rbp), %rcx
+	movl	%eax, 4(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -96(%rbp)
+	movslq	-96(%rbp), %rcx
+	movl	4(%rbx,%rcx,4), %eax
+	movl	%eax, -100(%rbp)
+	movl	-100(%rbp), %edi
+	call	cm_output
+	movl	$1, %edi
+	movl	$2, %esi
+	call	cm_pick
+	movl	%eax, -104(%rbp)
+	movl	$4, %edi
+	movl	$3, %esi
+	call	cm_pick
+	movl	%eax, -108(%rbp)
+	movl	-104(%rbp), %eax
+	addl	-108(%rbp), %eax
+	movl	%eax, -112(%rbp)
+	movl	-112(%rbp), %edi
+	call	cm_output
+	leal	0(%r12), %eax
+	movl	%eax, -116(%rbp)
+	movl	-116(%rbp), %edi
+	call	cm_chain
+	movl	%eax, -120(%rbp)
+	movl	-120(%rbp), %edi
+	call	cm_output
+	movl	$1, %edi
+	call	cm_bump
+	movl	%eax, -124(%rbp)
+	movl	-124(%rbp), %edi
+	call	cm_sq
+	movl	%eax, -44(%rbp)
+	movl	-44(%rbp), %edi
+	call	cm_output
+	call	cm_input
+	movl	%eax, -128(%rbp)
+	movl	-128(%rbp), %edi
+	call	cm_show
+	addq	$3, %r12
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
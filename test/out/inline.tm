@@ -0,0 +1,846 @@
+* TINY Compilation to TM Code
+* File: out/inline.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,57(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration input
+  7:     IN  0,0,0 	read integer value
+  8:    RET  6,0(0) 	return and pop arguments
+* <- function declaration input end
+* -> function declaration bump
+  9:  ENTER  4,0(6) 	push fp and allocate frame
+* -> compound 14 start
+* -> assign to g
+* -> generate code for rhs
+* -> Op
+* -> left
+* -> Id
+ 10:     LD  0,0(5) 	id: load value
+* <- Id
+* <- left
+* -> right
+* -> Id
+ 11:     LD  1,2(4) 	id: load value
+* <- Id
+* <- right
+ 12:    ADD  0,0,1 	op +
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 13:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* -> Id
+* <- Id
+ 14:  LEAVE  4,0(6) 	return: pop frame and fp
+ 15:    RET  6,1(0) 	return and pop arguments
+* <- compound 14 end
+* <- function declaration bump end
+* -> function declaration sq
+ 16:  ENTER  4,0(6) 	push fp and allocate frame
+* register 3 holds x
+ 17:     LD  3,2(4) 	load parameter into register
+* -> compound 15 start
+* -> Op
+ 18:    MUL  0,3,3 	op *
+* <- Op
+ 19:  LEAVE  4,0(6) 	return: pop frame and fp
+ 20:    RET  6,1(0) 	return and pop arguments
+* <- compound 15 end
+* <- function declaration sq end
+* -> function declaration pick
+ 21:  ENTER  4,0(6) 	push fp and allocate frame
+* register 3 holds a
+ 22:     LD  3,2(4) 	load parameter into register
+* register 2 holds b
+ 23:     LD  2,3(4) 	load parameter into register
+* -> compound 18 start
+* -> if start
+* -> condition
+ 24:    SUB  0,3,2 	condition: compare
+* <- condition
+ 25:    JLE  0,3(7) 	if: jmp to else
+* -> Id
+ 26:    LDA  0,0(3) 	id: copy register
+* <- Id
+ 27:  LEAVE  4,0(6) 	return: pop frame and fp
+ 28:    RET  6,2(0) 	return and pop arguments
+* <- if end
+* -> Id
+ 29:    LDA  0,0(2) 	id: copy register
+* <- Id
+ 30:  LEAVE  4,0(6) 	return: pop frame and fp
+ 31:    RET  6,2(0) 	return and pop arguments
+* <- compound 18 end
+* <- function declaration pick end
+* -> function declaration chain
+ 32:  ENTER  4,0(6) 	push fp and allocate frame
+* -> compound 19 start
+* -> compound 19 start
+* -> compound 12 start
+* register 3 holds dot.s
+* -> assign to dot.s
+* -> generate code for rhs in place
+* -> const 0
+ 33:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> compound 10 start
+* -> assign to dot.s
+* -> generate code for rhs in place
+* -> Op
+* -> Op
+* -> left
+* -> array
+* -> const 0
+ 34:    LDC  0,0(0) 	load const
+* <- Const end
+ 35:     LD  1,2(4) 	load array parameter address
+ 36:    ADD  0,0,1 	index + array address
+ 37:     LD  0,0(0) 	get value
+* <- left
+* -> right
+* -> array
+* -> const 0
+* <- Const end
+ 38:     LD  1,1(5) 	get value
+* <- right
+ 39:    MUL  0,0,1 	op *
+* <- Op
+ 40:    ADD  3,3,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to dot.s
+* -> generate code for rhs in place
+* -> Op
+* -> Op
+* -> left
+* -> array
+* -> const 1
+ 41:    LDC  0,1(0) 	load const
+* <- Const end
+ 42:     LD  1,2(4) 	load array parameter address
+ 43:    ADD  0,0,1 	index + array address
+ 44:     LD  0,0(0) 	get value
+* <- left
+* -> right
+* -> array
+* -> const 1
+* <- Const end
+ 45:     LD  1,2(5) 	get value
+* <- right
+ 46:    MUL  0,0,1 	op *
+* <- Op
+ 47:    ADD  3,3,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to dot.s
+* -> generate code for rhs in place
+* -> Op
+* -> Op
+* -> left
+* -> array
+* -> const 2
+ 48:    LDC  0,2(0) 	load const
+* <- Const end
+ 49:     LD  1,2(4) 	load array parameter address
+ 50:    ADD  0,0,1 	index + array address
+ 51:     LD  0,0(0) 	get value
+* <- left
+* -> right
+* -> array
+* -> const 2
+* <- Const end
+ 52:     LD  1,3(5) 	get value
+* <- right
+ 53:    MUL  0,0,1 	op *
+* <- Op
+ 54:    ADD  3,3,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 10 end
+* -> Id
+ 55:    LDA  0,0(3) 	id: copy register
+* <- Id
+ 56:  LEAVE  4,0(6) 	return: pop frame and fp
+ 57:    RET  6,1(0) 	return and pop arguments
+* <- compound 12 end
+* <- compound 19 end
+* <- compound 19 end
+ 58:  LEAVE  4,0(6) 	return: pop frame and fp
+ 59:    RET  6,1(0) 	return and pop arguments
+* <- function declaration chain end
+* -> function declaration main
+ 60:  ENTER  4,6(6) 	push fp and allocate frame
+* -> compound 43 start
+* cse.2 is at -4(fp)
+* u is at -3(fp)
+* register 3 holds x
+* register 2 holds y
+* -> assign to g
+* -> generate code for rhs
+* -> const 0
+ 61:    LDC  0,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+ 62:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* -> compound 23 start
+* -> compound 6 start
+* -> assign to u
+* -> generate code for rhs
+* -> const 2
+ 63:    LDC  0,2(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+ 64:     ST  0,-3(4) 	store
+* <- store value end
+* <- assign
+* -> assign to g
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 65:     LD  0,0(5) 	id: load value
+* <- Id
+ 66:    LDA  0,1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 67:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* <- compound 6 end
+* <- compound 23 end
+* -> compound 23 start
+* -> compound 6 start
+* -> assign to u
+* -> generate code for rhs
+* -> const 3
+ 68:    LDC  0,3(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+* <- Const end
+ 69:     ST  0,-2(4) 	store
+* <- store value end
+* <- assign
+* -> assign to g
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 70:     LD  0,0(5) 	id: load value
+* <- Id
+ 71:    LDA  0,1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 72:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* <- compound 6 end
+* <- compound 23 end
+* -> compound 23 start
+* -> compound 6 start
+* -> assign to u
+* -> generate code for rhs
+* -> const 4
+ 73:    LDC  0,4(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 2
+* <- Const end
+ 74:     ST  0,-1(4) 	store
+* <- store value end
+* <- assign
+* -> assign to g
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 75:     LD  0,0(5) 	id: load value
+* <- Id
+ 76:    LDA  0,1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 77:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* <- compound 6 end
+* <- compound 23 end
+* -> compound 24 start
+* -> compound 6 start
+* -> assign to t
+* -> generate code for rhs
+* -> const 1
+ 78:    LDC  0,1(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+ 79:     ST  0,1(5) 	store
+* <- store value end
+* <- assign
+* -> assign to g
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 80:     LD  0,0(5) 	id: load value
+* <- Id
+ 81:    LDA  0,1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 82:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* <- compound 6 end
+* <- compound 24 end
+* -> compound 24 start
+* -> compound 6 start
+* -> assign to t
+* -> generate code for rhs
+* -> const 1
+ 83:    LDC  0,1(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+* <- Const end
+ 84:     ST  0,2(5) 	store
+* <- store value end
+* <- assign
+* -> assign to g
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 85:     LD  0,0(5) 	id: load value
+* <- Id
+ 86:    LDA  0,1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 87:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* <- compound 6 end
+* <- compound 24 end
+* -> compound 24 start
+* -> compound 6 start
+* -> assign to t
+* -> generate code for rhs
+* -> const 10
+ 88:    LDC  0,10(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 2
+ 89:    LDC  1,2(0) 	load const
+* <- Const end
+ 90:     ST  0,1(1) 	store
+* <- store value end
+* <- assign
+* -> assign to g
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 91:     LD  0,0(5) 	id: load value
+* <- Id
+ 92:    LDA  0,1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 93:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* <- compound 6 end
+* <- compound 24 end
+* -> call function output
+* -> Id
+* <- Id
+ 94:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 95:    LDA  6,-1(6) 	stack growth after push arguments
+ 96:   CALL  6,-93(7) 	push return address and jump
+* <- call function output end
+* -> compound 26 start
+* -> compound 12 start
+* register 3 holds dot.s
+* -> assign to dot.s
+* -> generate code for rhs in place
+* -> const 0
+ 97:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> compound 10 start
+* -> assign to dot.s
+* -> generate code for rhs in place
+* -> Op
+* -> Op
+* -> left
+* -> array
+* -> const 0
+* <- Const end
+ 98:     LD  0,-3(4) 	get value
+* <- left
+ 99:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+* -> const 0
+* <- Const end
+100:     LD  0,1(5) 	get value
+* <- right
+101:     LD  1,-1(6) 	op: reload operand
+102:    MUL  0,1,0 	op *
+* <- Op
+103:    ADD  3,3,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to dot.s
+* -> generate code for rhs in place
+* -> Op
+* -> Op
+* -> left
+* -> array
+* -> const 1
+* <- Const end
+104:     LD  0,-2(4) 	get value
+* <- left
+105:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+* -> const 1
+* <- Const end
+106:     LD  0,2(5) 	get value
+* <- right
+107:     LD  1,-1(6) 	op: reload operand
+108:    MUL  0,1,0 	op *
+* <- Op
+109:    ADD  3,3,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to dot.s
+* -> generate code for rhs in place
+* -> Op
+* -> Op
+* -> left
+* -> array
+* -> const 2
+* <- Const end
+110:     LD  0,-1(4) 	get value
+* <- left
+111:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+* -> const 2
+* <- Const end
+112:     LD  0,3(5) 	get value
+* <- right
+113:     LD  1,-1(6) 	op: reload operand
+114:    MUL  0,1,0 	op *
+* <- Op
+115:    ADD  3,3,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 10 end
+* -> assign to x
+* -> generate code for rhs
+* -> Id
+116:    LDA  0,0(3) 	id: copy register
+* <- Id
+* <- generate code for rhs end
+117:    LDA  3,0(0) 	assign: move to register
+* <- assign
+* <- compound 12 end
+* <- compound 26 end
+* -> call function output
+118:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+119:     ST  3,-5(4) 	save register variable
+120:    LDA  6,-1(6) 	stack growth after push arguments
+121:   CALL  6,-118(7) 	push return address and jump
+122:     LD  3,-5(4) 	restore register variable
+* <- call function output end
+* -> compound 28 start
+* register 2 holds clamp.v
+* -> assign to clamp.v
+* -> generate code for rhs in place
+* -> Id
+123:    LDA  2,0(3) 	id: copy register
+* <- Id
+* <- generate code for rhs end
+* <- assign
+* -> compound 13 start
+* -> if start
+* -> condition
+124:    LDA  0,-30(3) 	condition: compare
+* <- condition
+125:    JLE  0,1(7) 	if: jmp to else
+* -> assign to clamp.v
+* -> generate code for rhs in place
+* -> const 30
+126:    LDC  2,30(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* <- if end
+* -> assign to y
+* -> generate code for rhs
+* -> Id
+127:    LDA  0,0(2) 	id: copy register
+* <- Id
+* <- generate code for rhs end
+128:    LDA  2,0(0) 	assign: move to register
+* <- assign
+* <- compound 13 end
+* <- compound 28 end
+* -> compound 29 start
+* -> compound 17 start
+* -> call function output
+129:     ST  2,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+130:     ST  2,-6(4) 	save register variable
+131:    LDA  6,-1(6) 	stack growth after push arguments
+132:   CALL  6,-129(7) 	push return address and jump
+133:     LD  2,-6(4) 	restore register variable
+* <- call function output end
+* <- compound 17 end
+* <- compound 29 end
+* -> compound 30 start
+* register 3 holds clamp.v
+* clamp.hi is at -4(fp)
+* -> assign to clamp.hi
+* -> generate code for rhs
+* -> call function bump
+* -> const 100
+134:    LDC  0,100(0) 	load const
+* <- Const end
+135:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+136:     ST  2,-6(4) 	save register variable
+137:    LDA  6,-1(6) 	stack growth after push arguments
+138:   CALL  6,-130(7) 	push return address and jump
+139:     LD  2,-6(4) 	restore register variable
+* <- call function bump end
+* <- generate code for rhs end
+* -> store value start
+140:     ST  0,-4(4) 	assign: store value
+* <- store value end
+* <- assign
+* -> assign to clamp.v
+* -> generate code for rhs in place
+* -> call function bump
+* -> const 5
+141:    LDC  0,5(0) 	load const
+* <- Const end
+142:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+143:     ST  2,-6(4) 	save register variable
+144:    LDA  6,-1(6) 	stack growth after push arguments
+145:   CALL  6,-137(7) 	push return address and jump
+146:     LD  2,-6(4) 	restore register variable
+147:    LDA  3,0(0) 	move return value
+* <- call function bump end
+* <- generate code for rhs end
+* <- assign
+* -> compound 13 start
+* -> if start
+* -> condition
+* -> Id
+148:     LD  0,-4(4) 	id: load value
+* <- Id
+149:    SUB  0,3,0 	condition: compare
+* <- condition
+150:    JLE  0,1(7) 	if: jmp to else
+* -> assign to clamp.v
+* -> generate code for rhs in place
+* -> Id
+151:     LD  3,-4(4) 	id: load value
+* <- Id
+* <- generate code for rhs end
+* <- assign
+* <- if end
+* -> assign to x
+* -> generate code for rhs
+* -> Id
+152:    LDA  0,0(3) 	id: copy register
+* <- Id
+* <- generate code for rhs end
+153:    LDA  3,0(0) 	assign: move to register
+* <- assign
+* <- compound 13 end
+* <- compound 30 end
+* -> call function output
+154:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+155:     ST  3,-5(4) 	save register variable
+156:     ST  2,-6(4) 	save register variable
+157:    LDA  6,-1(6) 	stack growth after push arguments
+158:   CALL  6,-155(7) 	push return address and jump
+159:     LD  3,-5(4) 	restore register variable
+160:     LD  2,-6(4) 	restore register variable
+* <- call function output end
+* -> call function output
+* -> Id
+161:     LD  0,0(5) 	id: load value
+* <- Id
+162:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+163:     ST  3,-5(4) 	save register variable
+164:     ST  2,-6(4) 	save register variable
+165:    LDA  6,-1(6) 	stack growth after push arguments
+166:   CALL  6,-163(7) 	push return address and jump
+167:     LD  3,-5(4) 	restore register variable
+168:     LD  2,-6(4) 	restore register variable
+* <- call function output end
+* -> call function output
+* -> Op
+* -> call function sq
+* -> Op
+169:    LDA  0,-100(3) 	op +/- const
+* <- Op
+170:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+171:     ST  3,-5(4) 	save register variable
+172:     ST  2,-6(4) 	save register variable
+173:    LDA  6,-1(6) 	stack growth after push arguments
+174:   CALL  6,-159(7) 	push return address and jump
+175:     LD  3,-5(4) 	restore register variable
+176:     LD  2,-6(4) 	restore register variable
+* <- call function sq end
+177:    LDA  0,9(0) 	op +/- const
+* <- Op
+178:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+179:     ST  3,-5(4) 	save register variable
+180:     ST  2,-6(4) 	save register variable
+181:    LDA  6,-1(6) 	stack growth after push arguments
+182:   CALL  6,-179(7) 	push return address and jump
+183:     LD  3,-5(4) 	restore register variable
+184:     LD  2,-6(4) 	restore register variable
+* <- call function output end
+* -> call function output
+* -> Op
+* -> left
+* -> assign to cse.2
+* -> generate code for rhs
+* -> array
+* -> const 1
+* <- Const end
+185:     LD  0,-2(4) 	get value
+* <- generate code for rhs end
+* -> store value start
+186:     ST  0,-4(4) 	assign: store value
+* <- store value end
+* <- assign
+* <- left
+* -> right
+* -> Id
+187:    LDA  1,0(0) 	id: load value
+* <- Id
+* <- right
+188:    ADD  0,0,1 	op +
+* <- Op
+189:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+190:     ST  3,-5(4) 	save register variable
+191:     ST  2,-6(4) 	save register variable
+192:    LDA  6,-1(6) 	stack growth after push arguments
+193:   CALL  6,-190(7) 	push return address and jump
+194:     LD  3,-5(4) 	restore register variable
+195:     LD  2,-6(4) 	restore register variable
+* <- call function output end
+* -> compound 35 start
+* register 2 holds show.v
+* -> assign to show.v
+* -> generate code for rhs
+* -> Op
+196:    MUL  0,2,2 	op *
+* <- Op
+* <- generate code for rhs end
+197:    LDA  2,0(0) 	assign: move to register
+* <- assign
+* -> compound 17 start
+* -> call function output
+198:     ST  2,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+199:     ST  3,-5(4) 	save register variable
+200:    LDA  6,-1(6) 	stack growth after push arguments
+201:   CALL  6,-198(7) 	push return address and jump
+202:     LD  3,-5(4) 	restore register variable
+* <- call function output end
+* <- compound 17 end
+* <- compound 35 end
+* -> assign to u
+* -> generate code for rhs
+* -> call function pick
+* -> const 7
+203:    LDC  0,7(0) 	load const
+* <- Const end
+204:     ST  0,-1(6) 	op: push argument(reverse order)
+205:     ST  3,-2(6) 	op: push argument(reverse order)
+* 2 arguments are pushed
+206:    LDA  6,-2(6) 	stack growth after push arguments
+207:   CALL  6,-187(7) 	push return address and jump
+* <- call function pick end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+* <- Const end
+208:    LDA  1,1(4) 	index + local base
+209:     ST  0,-3(1) 	store
+* <- store value end
+* <- assign
+* -> call function output
+* -> array
+* -> const 1
+* <- Const end
+210:     LD  0,-2(4) 	get value
+211:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+212:    LDA  6,-1(6) 	stack growth after push arguments
+213:   CALL  6,-210(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> Op
+* -> left
+* -> call function pick
+* -> const 2
+214:    LDC  0,2(0) 	load const
+* <- Const end
+215:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> const 1
+216:    LDC  0,1(0) 	load const
+* <- Const end
+217:     ST  0,-2(6) 	op: push argument(reverse order)
+* 2 arguments are pushed
+218:    LDA  6,-2(6) 	stack growth after push arguments
+219:   CALL  6,-199(7) 	push return address and jump
+* <- call function pick end
+* <- left
+220:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> call function pick
+* -> const 3
+221:    LDC  0,3(0) 	load const
+* <- Const end
+222:     ST  0,-2(6) 	op: push argument(reverse order)
+* -> const 4
+223:    LDC  0,4(0) 	load const
+* <- Const end
+224:     ST  0,-3(6) 	op: push argument(reverse order)
+* 2 arguments are pushed
+225:    LDA  6,-3(6) 	stack growth after push arguments
+226:   CALL  6,-206(7) 	push return address and jump
+227:    LDA  6,1(6) 	pop temporaries
+* <- call function pick end
+* <- right
+228:     LD  1,-1(6) 	op: reload operand
+229:    ADD  0,1,0 	op +
+* <- Op
+230:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+231:    LDA  6,-1(6) 	stack growth after push arguments
+232:   CALL  6,-229(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> call function chain
+* -> array
+233:    LDA  0,-3(4) 	id : load address
+234:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+235:    LDA  6,-1(6) 	stack growth after push arguments
+236:   CALL  6,-205(7) 	push return address and jump
+* <- call function chain end
+237:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+238:    LDA  6,-1(6) 	stack growth after push arguments
+239:   CALL  6,-236(7) 	push return address and jump
+* <- call function output end
+* -> compound 40 start
+* register 3 holds sq.x
+* -> assign to sq.x
+* -> generate code for rhs in place
+* -> call function bump
+* -> const 1
+240:    LDC  0,1(0) 	load const
+* <- Const end
+241:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+242:    LDA  6,-1(6) 	stack growth after push arguments
+243:   CALL  6,-235(7) 	push return address and jump
+244:    LDA  3,0(0) 	move return value
+* <- call function bump end
+* <- generate code for rhs end
+* <- assign
+* -> compound 15 start
+* -> assign to y
+* -> generate code for rhs in place
+* -> Op
+245:    MUL  2,3,3 	op *
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 15 end
+* <- compound 40 end
+* -> call function output
+246:     ST  2,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+247:    LDA  6,-1(6) 	stack growth after push arguments
+248:   CALL  6,-245(7) 	push return address and jump
+* <- call function output end
+* -> compound 42 start
+* register 3 holds show.v
+* -> assign to show.v
+* -> generate code for rhs in place
+* -> call function input
+* 0 arguments are pushed
+249:   CALL  6,-243(7) 	push return address and jump
+250:    LDA  3,0(0) 	move return value
+* <- call function input end
+* <- generate code for rhs end
+* <- assign
+* -> compound 17 start
+* -> call function output
+251:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+252:    LDA  6,-1(6) 	stack growth after push arguments
+253:   CALL  6,-250(7) 	push return address and jump
+* <- call function output end
+* <- compound 17 end
+* <- compound 42 end
+* <- compound 43 end
+254:  LEAVE  4,0(6) 	return: pop frame and fp
+255:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
@@ -0,0 +1,194 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_input, @function
+cm_input:
+	subq	$24, %rsp
+	leaq	.Lformat_in(%rip), %rdi
+	leaq	12(%rsp), %rsi
+	xorl	%eax, %eax
+	call	scanf@PLT
+	cmpl	$1, %eax
+	jne	.Lbad_input
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	ret
+.Lbad_input:
+	movl	$1, %edi
+	call	exit@PLT
+	.type	cm_minloc, @function
+cm_minloc:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	movl	%edx, -12(%rbp)
+.Lminloc_0:
+	movl	-8(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-4(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	movslq	-20(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -24(%rbp)
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -28(%rbp)
+	jmp	.Lminloc_4
+.Lminloc_1:
+	movl	-4(%rbp), %eax
+	addl	-28(%rbp), %eax
+	movl	%eax, -32(%rbp)
+	movslq	-32(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -36(%rbp)
+	movl	-36(%rbp), %eax
+	subl	-24(%rbp), %eax
+	testl	%eax, %eax
+	jge	.Lminloc_3
+.Lminloc_2:
+	movl	-4(%rbp), %eax
+	addl	-28(%rbp), %eax
+	movl	%eax, -40(%rbp)
+	movslq	-40(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -24(%rbp)
+	movl	-28(%rbp), %eax
+	movl	%eax, -16(%rbp)
+.Lminloc_3:
+	movl	-28(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -28(%rbp)
+.Lminloc_4:
+	movl	-28(%rbp), %eax
+	subl	-12(%rbp), %eax
+	testl	%eax, %eax
+	jl	.Lminloc_1
+.Lminloc_5:
+	movl	-16(%rbp), %eax
+	leave
+	ret
+	.type	cm_bump, @function
+cm_bump:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movl	%edi, -4(%rbp)
+.Lbump_0:
+	movl	$0, %eax
+	movl	%eax, -8(%rbp)
+	jmp	.Lbump_2
+.Lbump_1:
+	movl	-4(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -12(%rbp)
+	movslq	-12(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %eax
+	movslq	-12(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -8(%rbp)
+.Lbump_2:
+	movl	40(%rbx), %eax
+	movl	%eax, -24(%rbp)
+	movl	-8(%rbp), %eax
+	subl	-24(%rbp), %eax
+	testl	%eax, %eax
+	jl	.Lbump_1
+.Lbump_3:
+	leave
+	ret
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+.Lmain_0:
+	movl	$0, %eax
+	movl	%eax, -4(%rbp)
+	jmp	.Lmain_2
+.Lmain_1:
+	call	cm_input
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %eax
+	movslq	-4(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	movl	-4(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -4(%rbp)
+.Lmain_2:
+	movl	-4(%rbp), %eax
+	subl	$10, %eax
+	testl	%eax, %eax
+	jl	.Lmain_1
+.Lmain_3:
+	movl	$10, %eax
+	movl	%eax, 40(%rbx)
+	movl	$0, %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %edi
+	call	cm_bump
+	movl	$0, %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %edi
+	movl	$0, %esi
+	movl	$10, %edx
+	call	cm_minloc
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %edi
+	call	cm_output
+	movl	$0, %eax
+	movl	%eax, -24(%rbp)
+	movl	-24(%rbp), %edi
+	movl	$0, %esi
+	movl	$10, %edx
+	call	cm_minloc
+	movl	%eax, -28(%rbp)
+	movslq	-28(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -32(%rbp)
+	movl	-32(%rbp), %edi
+	call	cm_output
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
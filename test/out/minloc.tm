@@ -0,0 +1,402 @@
+* TINY Compilation to TM Code
+* File: out/minloc.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,47(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration input
+  7:     IN  0,0,0 	read integer value
+  8:    RET  6,0(0) 	return and pop arguments
+* <- function declaration input end
+* -> function declaration minloc
+  9:  ENTER  4,1(6) 	push fp and allocate frame
+* register 3 holds low
+ 10:     LD  3,3(4) 	load parameter into register
+* -> compound 20 start
+* register 3 holds i
+* register 2 holds x
+* k is at -1(fp)
+* -> assign to k
+* -> generate code for rhs
+* -> Id
+ 11:    LDA  0,0(3) 	id: copy register
+* <- Id
+* <- generate code for rhs end
+* -> store value start
+ 12:     ST  0,-1(4) 	assign: store value
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs in place
+* -> array
+ 13:     LD  0,2(4) 	load array parameter address
+ 14:    ADD  2,3,0 	index + array address
+ 15:     LD  2,0(2) 	get value
+* <- generate code for rhs end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 16:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> while start
+ 17:    LDA  7,11(7) 	while : jump to test
+* while : body start
+* -> compound 18 start
+* -> if start
+* -> condition
+* -> array
+ 18:     LD  1,2(4) 	load array parameter address
+ 19:    ADD  0,3,1 	index + array address
+ 20:     LD  0,0(0) 	get value
+ 21:    SUB  0,0,2 	condition: compare
+* <- condition
+ 22:    JGE  0,5(7) 	if: jmp to else
+* -> compound 16 start
+* -> assign to x
+* -> generate code for rhs in place
+* -> array
+ 23:     LD  0,2(4) 	load array parameter address
+ 24:    ADD  2,3,0 	index + array address
+ 25:     LD  2,0(2) 	get value
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs
+* -> Id
+ 26:    LDA  0,0(3) 	id: copy register
+* <- Id
+* <- generate code for rhs end
+* -> store value start
+ 27:     ST  0,-1(4) 	assign: store value
+* <- store value end
+* <- assign
+* <- compound 16 end
+* <- if end
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 28:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 18 end
+* while : body end
+* while : test expression start
+* -> condition
+* -> Id
+ 29:     LD  0,4(4) 	id: load value
+* <- Id
+ 30:    SUB  0,3,0 	condition: compare
+* <- condition
+ 31:    JLT  0,-14(7) 	while : true
+* while : test expression end
+* -> Id
+ 32:     LD  0,-1(4) 	id: load value
+* <- Id
+ 33:  LEAVE  4,0(6) 	return: pop frame and fp
+ 34:    RET  6,3(0) 	return and pop arguments
+* <- compound 20 end
+* <- function declaration minloc end
+* -> function declaration bump
+ 35:  ENTER  4,0(6) 	push fp and allocate frame
+* -> compound 29 start
+* register 3 holds i
+* -> assign to i
+* -> generate code for rhs in place
+* -> const 0
+ 36:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> compound 25 start
+* register 2 holds ptr.1
+* -> assign to ptr.1
+* -> generate code for rhs in place
+* -> Op
+* -> array
+ 37:     LD  2,2(4) 	id : load address
+ 38:    ADD  2,2,3 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> while start
+ 39:    LDA  7,5(7) 	while : jump to test
+* while : body start
+* -> compound 28 start
+* -> assign to mem
+* -> generate code for rhs
+* -> Op
+* -> array
+ 40:     LD  0,0(2) 	get value
+ 41:    ADD  0,0,3 	op +
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+* -> array
+ 42:     ST  0,0(2) 	store
+* <- store value end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 43:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to ptr.1
+* -> generate code for rhs in place
+* -> Op
+ 44:    LDA  2,1(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 28 end
+* while : body end
+* while : test expression start
+* -> condition
+* -> Id
+ 45:     LD  0,10(5) 	id: load value
+* <- Id
+ 46:    SUB  0,3,0 	condition: compare
+* <- condition
+ 47:    JLT  0,-8(7) 	while : true
+* while : test expression end
+* <- compound 25 end
+* <- compound 29 end
+ 48:  LEAVE  4,0(6) 	return: pop frame and fp
+ 49:    RET  6,1(0) 	return and pop arguments
+* <- function declaration bump end
+* -> function declaration main
+ 50:  ENTER  4,0(6) 	push fp and allocate frame
+* -> compound 42 start
+* -> compound 34 start
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 51:   CALL  6,-45(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+ 52:    LDC  1,0(0) 	load const
+* <- Const end
+ 53:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 54:   CALL  6,-48(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+ 55:    LDC  1,1(0) 	load const
+* <- Const end
+ 56:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 57:   CALL  6,-51(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 2
+ 58:    LDC  1,2(0) 	load const
+* <- Const end
+ 59:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 60:   CALL  6,-54(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 3
+ 61:    LDC  1,3(0) 	load const
+* <- Const end
+ 62:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 63:   CALL  6,-57(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 4
+ 64:    LDC  1,4(0) 	load const
+* <- Const end
+ 65:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 66:   CALL  6,-60(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 5
+ 67:    LDC  1,5(0) 	load const
+* <- Const end
+ 68:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 69:   CALL  6,-63(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 6
+ 70:    LDC  1,6(0) 	load const
+* <- Const end
+ 71:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 72:   CALL  6,-66(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 7
+ 73:    LDC  1,7(0) 	load const
+* <- Const end
+ 74:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 75:   CALL  6,-69(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 8
+ 76:    LDC  1,8(0) 	load const
+* <- Const end
+ 77:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 78:   CALL  6,-72(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 9
+ 79:    LDC  1,9(0) 	load const
+* <- Const end
+ 80:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* <- compound 34 end
+* -> assign to size
+* -> generate code for rhs
+* -> const 10
+ 81:    LDC  0,10(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+ 82:     ST  0,10(5) 	assign: store value
+* <- store value end
+* <- assign
+* -> call function bump
+* -> array
+ 83:    LDA  0,0(5) 	id : load address
+ 84:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 85:    LDA  6,-1(6) 	stack growth after push arguments
+ 86:   CALL  6,-52(7) 	push return address and jump
+* <- call function bump end
+* -> call function output
+* -> call function minloc
+* -> const 10
+ 87:    LDC  0,10(0) 	load const
+* <- Const end
+ 88:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> const 0
+ 89:    LDC  0,0(0) 	load const
+* <- Const end
+ 90:     ST  0,-2(6) 	op: push argument(reverse order)
+* -> array
+ 91:    LDA  0,0(5) 	id : load address
+ 92:     ST  0,-3(6) 	op: push argument(reverse order)
+* 3 arguments are pushed
+ 93:    LDA  6,-3(6) 	stack growth after push arguments
+ 94:   CALL  6,-86(7) 	push return address and jump
+* <- call function minloc end
+ 95:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 96:    LDA  6,-1(6) 	stack growth after push arguments
+ 97:   CALL  6,-94(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> call function minloc
+* -> const 10
+ 98:    LDC  0,10(0) 	load const
+* <- Const end
+ 99:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> const 0
+100:    LDC  0,0(0) 	load const
+* <- Const end
+101:     ST  0,-2(6) 	op: push argument(reverse order)
+* -> array
+102:    LDA  0,0(5) 	id : load address
+103:     ST  0,-3(6) 	op: push argument(reverse order)
+* 3 arguments are pushed
+104:    LDA  6,-3(6) 	stack growth after push arguments
+105:   CALL  6,-97(7) 	push return address and jump
+* <- call function minloc end
+106:     LD  0,0(0) 	get value
+107:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+108:    LDA  6,-1(6) 	stack growth after push arguments
+109:   CALL  6,-106(7) 	push return address and jump
+* <- call function output end
+* <- compound 42 end
+110:  LEAVE  4,0(6) 	return: pop frame and fp
+111:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
@@ -0,0 +1,159 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_input, @function
+cm_input:
+	subq	$24, %rsp
+	leaq	.Lformat_in(%rip), %rdi
+	leaq	12(%rsp), %rsi
+	xorl	%eax, %eax
+	call	scanf@PLT
+	cmpl	$1, %eax
+	jne	.Lbad_input
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	ret
+.Lbad_input:
+	movl	$1, %edi
+	call	exit@PLT
+	.type	cm_next, @function
+cm_next:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+.Lnext_0:
+	movl	-4(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %eax
+	leave
+	ret
+	.type	cm_rare, @function
+cm_rare:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+.Lrare_0:
+	movl	0(%rbx), %eax
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %eax
+	movl	%eax, 0(%rbx)
+	movl	-4(%rbp), %eax
+	imull	$2, %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %eax
+	leave
+	ret
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+.Lmain_0:
+	call	cm_input
+	movl	%eax, -4(%rbp)
+	movl	$0, %eax
+	movl	%eax, -8(%rbp)
+	movl	$0, %eax
+	movl	%eax, -12(%rbp)
+	movl	$0, %eax
+	movl	%eax, 0(%rbx)
+	jmp	.Lmain_5
+.Lmain_1:
+	movl	-8(%rbp), %eax
+	movl	$10, %ecx
+	cltd
+	idivl	%ecx
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %eax
+	imull	$10, %eax
+	movl	%eax, -20(%rbp)
+	movl	-8(%rbp), %eax
+	subl	-20(%rbp), %eax
+	movl	%eax, -24(%rbp)
+	movl	-24(%rbp), %eax
+	testl	%eax, %eax
+	je	.Lmain_3
+.Lmain_2:
+	movl	-8(%rbp), %edi
+	call	cm_next
+	movl	%eax, -28(%rbp)
+	movl	-12(%rbp), %eax
+	addl	-28(%rbp), %eax
+	movl	%eax, -12(%rbp)
+	jmp	.Lmain_4
+.Lmain_3:
+	movl	-8(%rbp), %edi
+	call	cm_rare
+	movl	%eax, -32(%rbp)
+	movl	-12(%rbp), %eax
+	subl	-32(%rbp), %eax
+	movl	%eax, -12(%rbp)
+.Lmain_4:
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -8(%rbp)
+.Lmain_5:
+	movl	-8(%rbp), %eax
+	subl	-4(%rbp), %eax
+	testl	%eax, %eax
+	jl	.Lmain_1
+.Lmain_6:
+	movl	-12(%rbp), %edi
+	call	cm_output
+	jmp	.Lmain_8
+.Lmain_7:
+	movl	-12(%rbp), %edi
+	call	cm_output
+	movl	-12(%rbp), %eax
+	addl	$1000000, %eax
+	movl	%eax, -12(%rbp)
+.Lmain_8:
+	movl	-12(%rbp), %eax
+	testl	%eax, %eax
+	jl	.Lmain_7
+.Lmain_9:
+	movl	0(%rbx), %eax
+	movl	%eax, -36(%rbp)
+	movl	-36(%rbp), %edi
+	call	cm_output
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
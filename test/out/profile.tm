@@ -0,0 +1,197 @@
+* TINY Compilation to TM Code
+* File: out/profile.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,14(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration input
+  7:     IN  0,0,0 	read integer value
+  8:    RET  6,0(0) 	return and pop arguments
+* <- function declaration input end
+* -> function declaration rare
+  9:  ENTER  4,0(6) 	push fp and allocate frame
+* -> compound 13 start
+* -> assign to hits
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 10:     LD  0,0(5) 	id: load value
+* <- Id
+ 11:    LDA  0,1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 12:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* -> Op
+* -> Id
+ 13:     LD  0,2(4) 	id: load value
+* <- Id
+ 14:    SHL  0,1(0) 	op * by shift
+* <- Op
+ 15:  LEAVE  4,0(6) 	return: pop frame and fp
+ 16:    RET  6,1(0) 	return and pop arguments
+* <- compound 13 end
+* <- function declaration rare end
+* -> function declaration main
+ 17:  ENTER  4,3(6) 	push fp and allocate frame
+* -> compound 30 start
+* register 2 holds i
+* register 3 holds s
+* n is at -3(fp)
+* -> assign to n
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 18:   CALL  6,-12(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+ 19:     ST  0,-3(4) 	assign: store value
+* <- store value end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> const 0
+ 20:    LDC  2,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> assign to s
+* -> generate code for rhs in place
+* -> const 0
+ 21:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> assign to hits
+* -> generate code for rhs
+* -> const 0
+ 22:    LDC  0,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+ 23:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* -> while start
+ 24:    LDA  7,18(7) 	while : jump to test
+* while : body start
+* -> compound 23 start
+* -> if start
+* -> condition
+* -> Op
+ 25:    LDC  0,10(0) 	load const operand
+ 26:    MOD  0,2,0 	op %
+* <- Op
+* <- condition
+ 27:    JNE  0,12(7) 	if: jmp to then
+* -> assign to s
+* -> generate code for rhs
+* -> Op
+* -> left
+* -> Id
+ 28:    LDA  0,0(3) 	id: copy register
+* <- Id
+* <- left
+ 29:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> call function rare
+ 30:     ST  2,-2(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 31:     ST  2,-1(4) 	save register variable
+ 32:    LDA  6,-2(6) 	stack growth after push arguments
+ 33:   CALL  6,-25(7) 	push return address and jump
+ 34:    LDA  6,1(6) 	pop temporaries
+ 35:     LD  2,-1(4) 	restore register variable
+* <- call function rare end
+* <- right
+ 36:     LD  1,-1(6) 	op: reload operand
+ 37:    SUB  0,1,0 	op -
+* <- Op
+* <- generate code for rhs end
+ 38:    LDA  3,0(0) 	assign: move to register
+* <- assign
+ 39:    LDA  7,2(7) 	jmp to end
+* -> assign to s
+* -> generate code for rhs in place
+* -> Op
+* -> Op
+ 40:    LDA  0,1(2) 	op +/- const
+* <- Op
+ 41:    ADD  3,3,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- if end
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 42:    LDA  2,1(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 23 end
+* while : body end
+* while : test expression start
+* -> condition
+* -> Id
+ 43:     LD  0,-3(4) 	id: load value
+* <- Id
+ 44:    SUB  0,2,0 	condition: compare
+* <- condition
+ 45:    JLT  0,-21(7) 	while : true
+* while : test expression end
+* -> call function output
+ 46:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 47:     ST  3,-2(4) 	save register variable
+ 48:    LDA  6,-1(6) 	stack growth after push arguments
+ 49:   CALL  6,-46(7) 	push return address and jump
+ 50:     LD  3,-2(4) 	restore register variable
+* <- call function output end
+* -> while start
+* -> condition
+* <- condition
+ 51:    JGE  3,7(7) 	while : false
+* -> compound 28 start
+* -> call function output
+ 52:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 53:     ST  3,-2(4) 	save register variable
+ 54:    LDA  6,-1(6) 	stack growth after push arguments
+ 55:   CALL  6,-52(7) 	push return address and jump
+ 56:     LD  3,-2(4) 	restore register variable
+* <- call function output end
+* -> assign to s
+* -> generate code for rhs in place
+* -> Op
+ 57:    LDA  3,1000000(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 28 end
+ 58:    LDA  7,-8(7) 	while : jump to test
+* <- while end
+* -> call function output
+* -> Id
+ 59:     LD  0,0(5) 	id: load value
+* <- Id
+ 60:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 61:    LDA  6,-1(6) 	stack growth after push arguments
+ 62:   CALL  6,-59(7) 	push return address and jump
+* <- call function output end
+* <- compound 30 end
+ 63:  LEAVE  4,0(6) 	return: pop frame and fp
+ 64:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
@@ -0,0 +1,205 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_input, @function
+cm_input:
+	subq	$24, %rsp
+	leaq	.Lformat_in(%rip), %rdi
+	leaq	12(%rsp), %rsi
+	xorl	%eax, %eax
+	call	scanf@PLT
+	cmpl	$1, %eax
+	jne	.Lbad_input
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	ret
+.Lbad_input:
+	movl	$1, %edi
+	call	exit@PLT
+	.type	cm_minloc, @function
+cm_minloc:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	movl	%edx, -12(%rbp)
+.Lminloc_0:
+	movl	-8(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-4(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	movslq	-20(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -24(%rbp)
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -28(%rbp)
+	jmp	.Lminloc_4
+.Lminloc_1:
+	movl	-4(%rbp), %eax
+	addl	-28(%rbp), %eax
+	movl	%eax, -32(%rbp)
+	movslq	-32(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -36(%rbp)
+	movl	-36(%rbp), %eax
+	subl	-24(%rbp), %eax
+	testl	%eax, %eax
+	jge	.Lminloc_3
+.Lminloc_2:
+	movl	-4(%rbp), %eax
+	addl	-28(%rbp), %eax
+	movl	%eax, -40(%rbp)
+	movslq	-40(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -24(%rbp)
+	movl	-28(%rbp), %eax
+	movl	%eax, -16(%rbp)
+.Lminloc_3:
+	movl	-28(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -28(%rbp)
+.Lminloc_4:
+	movl	-28(%rbp), %eax
+	subl	-12(%rbp), %eax
+	testl	%eax, %eax
+	jl	.Lminloc_1
+.Lminloc_5:
+	movl	-16(%rbp), %eax
+	leave
+	ret
+	.type	cm_sort, @function
+cm_sort:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	movl	%edx, -12(%rbp)
+.Lsort_0:
+	movl	-8(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	jmp	.Lsort_2
+.Lsort_1:
+	movl	-4(%rbp), %edi
+	movl	-16(%rbp), %esi
+	movl	-12(%rbp), %edx
+	call	cm_minloc
+	movl	%eax, -20(%rbp)
+	movl	-4(%rbp), %eax
+	addl	-20(%rbp), %eax
+	movl	%eax, -24(%rbp)
+	movslq	-24(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -28(%rbp)
+	movl	-4(%rbp), %eax
+	addl	-16(%rbp), %eax
+	movl	%eax, -32(%rbp)
+	movslq	-32(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -36(%rbp)
+	movl	-36(%rbp), %eax
+	movslq	-24(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	movl	-28(%rbp), %eax
+	movslq	-32(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	movl	-16(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -16(%rbp)
+.Lsort_2:
+	movl	-12(%rbp), %eax
+	subl	$1, %eax
+	movl	%eax, -40(%rbp)
+	movl	-16(%rbp), %eax
+	subl	-40(%rbp), %eax
+	testl	%eax, %eax
+	jl	.Lsort_1
+.Lsort_3:
+	leave
+	ret
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+.Lmain_0:
+	movl	$0, %eax
+	movl	%eax, -4(%rbp)
+	jmp	.Lmain_2
+.Lmain_1:
+	call	cm_input
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %eax
+	movslq	-4(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	movl	-4(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -4(%rbp)
+.Lmain_2:
+	movl	-4(%rbp), %eax
+	subl	$10, %eax
+	testl	%eax, %eax
+	jl	.Lmain_1
+.Lmain_3:
+	movl	$0, %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %edi
+	movl	$0, %esi
+	movl	$10, %edx
+	call	cm_sort
+	movl	$0, %eax
+	movl	%eax, -4(%rbp)
+	jmp	.Lmain_5
+.Lmain_4:
+	movslq	-4(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %edi
+	call	cm_output
+	movl	-4(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -4(%rbp)
+.Lmain_5:
+	movl	-4(%rbp), %eax
+	subl	$10, %eax
+	testl	%eax, %eax
+	jl	.Lmain_4
+.Lmain_6:
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,519 @@
+* TINY Compilation to TM Code
+* File: out/sort.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,66(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration input
+  7:     IN  0,0,0 	read integer value
+  8:    RET  6,0(0) 	return and pop arguments
+* <- function declaration input end
+* -> function declaration minloc
+  9:  ENTER  4,1(6) 	push fp and allocate frame
+* register 3 holds low
+ 10:     LD  3,3(4) 	load parameter into register
+* -> compound 17 start
+* register 3 holds i
+* register 2 holds x
+* k is at -1(fp)
+* -> assign to k
+* -> generate code for rhs
+* -> Id
+ 11:    LDA  0,0(3) 	id: copy register
+* <- Id
+* <- generate code for rhs end
+* -> store value start
+ 12:     ST  0,-1(4) 	assign: store value
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs in place
+* -> array
+ 13:     LD  0,2(4) 	load array parameter address
+ 14:    ADD  2,3,0 	index + array address
+ 15:     LD  2,0(2) 	get value
+* <- generate code for rhs end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 16:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> while start
+ 17:    LDA  7,11(7) 	while : jump to test
+* while : body start
+* -> compound 14 start
+* -> if start
+* -> condition
+* -> array
+ 18:     LD  1,2(4) 	load array parameter address
+ 19:    ADD  0,3,1 	index + array address
+ 20:     LD  0,0(0) 	get value
+ 21:    SUB  0,0,2 	condition: compare
+* <- condition
+ 22:    JGE  0,5(7) 	if: jmp to else
+* -> compound 12 start
+* -> assign to x
+* -> generate code for rhs in place
+* -> array
+ 23:     LD  0,2(4) 	load array parameter address
+ 24:    ADD  2,3,0 	index + array address
+ 25:     LD  2,0(2) 	get value
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs
+* -> Id
+ 26:    LDA  0,0(3) 	id: copy register
+* <- Id
+* <- generate code for rhs end
+* -> store value start
+ 27:     ST  0,-1(4) 	assign: store value
+* <- store value end
+* <- assign
+* <- compound 12 end
+* <- if end
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 28:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 14 end
+* while : body end
+* while : test expression start
+* -> condition
+* -> Id
+ 29:     LD  0,4(4) 	id: load value
+* <- Id
+ 30:    SUB  0,3,0 	condition: compare
+* <- condition
+ 31:    JLT  0,-14(7) 	while : true
+* while : test expression end
+* -> Id
+ 32:     LD  0,-1(4) 	id: load value
+* <- Id
+ 33:  LEAVE  4,0(6) 	return: pop frame and fp
+ 34:    RET  6,3(0) 	return and pop arguments
+* <- compound 17 end
+* <- function declaration minloc end
+* -> function declaration sort
+ 35:  ENTER  4,4(6) 	push fp and allocate frame
+* -> compound 30 start
+* register 3 holds i
+* register 2 holds k
+* -> assign to i
+* -> generate code for rhs in place
+* -> Id
+ 36:     LD  3,3(4) 	id: load value
+* <- Id
+* <- generate code for rhs end
+* <- assign
+* -> compound 22 start
+* inv.1 is at -2(fp)
+* -> assign to inv.1
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 37:     LD  0,4(4) 	id: load value
+* <- Id
+ 38:    LDA  0,-1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 39:     ST  0,-2(4) 	assign: store value
+* <- store value end
+* <- assign
+* -> while start
+ 40:    LDA  7,23(7) 	while : jump to test
+* while : body start
+* -> compound 29 start
+* register 2 holds addr.2
+* addr.1 is at -3(fp)
+* t is at -4(fp)
+* -> assign to k
+* -> generate code for rhs in place
+* -> call function minloc
+* -> Id
+ 41:     LD  0,4(4) 	id: load value
+* <- Id
+ 42:     ST  0,-1(6) 	op: push argument(reverse order)
+ 43:     ST  3,-2(6) 	op: push argument(reverse order)
+* -> Id
+ 44:     LD  0,2(4) 	id: load value
+* <- Id
+ 45:     ST  0,-3(6) 	op: push argument(reverse order)
+* 3 arguments are pushed
+ 46:     ST  3,-1(4) 	save register variable
+ 47:    LDA  6,-3(6) 	stack growth after push arguments
+ 48:   CALL  6,-40(7) 	push return address and jump
+ 49:     LD  3,-1(4) 	restore register variable
+ 50:    LDA  2,0(0) 	move return value
+* <- call function minloc end
+* <- generate code for rhs end
+* <- assign
+* -> assign to t
+* -> generate code for rhs
+* -> array
+* -> assign to addr.2
+* -> generate code for rhs in place
+* -> Op
+* -> array
+ 51:     LD  0,2(4) 	id : load address
+ 52:    ADD  2,0,2 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+ 53:     LD  0,0(2) 	get value
+* <- generate code for rhs end
+* -> store value start
+ 54:     ST  0,-4(4) 	assign: store value
+* <- store value end
+* <- assign
+* -> assign to mem
+* -> generate code for rhs
+* -> array
+* -> assign to addr.1
+* -> generate code for rhs
+* -> Op
+* -> array
+ 55:     LD  0,2(4) 	id : load address
+ 56:    ADD  0,0,3 	op +
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 57:     ST  0,-3(4) 	assign: store value
+* <- store value end
+* <- assign
+ 58:     LD  0,0(0) 	get value
+* <- generate code for rhs end
+* -> store value start
+* -> array
+ 59:     ST  0,0(2) 	store
+* <- store value end
+* <- assign
+* -> assign to mem
+* -> generate code for rhs
+* -> Id
+ 60:     LD  0,-4(4) 	id: load value
+* <- Id
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> Id
+ 61:     LD  1,-3(4) 	id: load value
+* <- Id
+ 62:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 63:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 29 end
+* while : body end
+* while : test expression start
+* -> condition
+* -> Id
+ 64:     LD  0,-2(4) 	id: load value
+* <- Id
+ 65:    SUB  0,3,0 	condition: compare
+* <- condition
+ 66:    JLT  0,-26(7) 	while : true
+* while : test expression end
+* <- compound 22 end
+* <- compound 30 end
+ 67:  LEAVE  4,0(6) 	return: pop frame and fp
+ 68:    RET  6,3(0) 	return and pop arguments
+* <- function declaration sort end
+* -> function declaration main
+ 69:  ENTER  4,0(6) 	push fp and allocate frame
+* -> compound 46 start
+* -> compound 35 start
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 70:   CALL  6,-64(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+ 71:    LDC  1,0(0) 	load const
+* <- Const end
+ 72:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 73:   CALL  6,-67(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+ 74:    LDC  1,1(0) 	load const
+* <- Const end
+ 75:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 76:   CALL  6,-70(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 2
+ 77:    LDC  1,2(0) 	load const
+* <- Const end
+ 78:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 79:   CALL  6,-73(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 3
+ 80:    LDC  1,3(0) 	load const
+* <- Const end
+ 81:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 82:   CALL  6,-76(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 4
+ 83:    LDC  1,4(0) 	load const
+* <- Const end
+ 84:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 85:   CALL  6,-79(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 5
+ 86:    LDC  1,5(0) 	load const
+* <- Const end
+ 87:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 88:   CALL  6,-82(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 6
+ 89:    LDC  1,6(0) 	load const
+* <- Const end
+ 90:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 91:   CALL  6,-85(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 7
+ 92:    LDC  1,7(0) 	load const
+* <- Const end
+ 93:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 94:   CALL  6,-88(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 8
+ 95:    LDC  1,8(0) 	load const
+* <- Const end
+ 96:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> assign to x
+* -> generate code for rhs
+* -> call function input
+* 0 arguments are pushed
+ 97:   CALL  6,-91(7) 	push return address and jump
+* <- call function input end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 9
+ 98:    LDC  1,9(0) 	load const
+* <- Const end
+ 99:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* <- compound 35 end
+* -> call function sort
+* -> const 10
+100:    LDC  0,10(0) 	load const
+* <- Const end
+101:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> const 0
+102:    LDC  0,0(0) 	load const
+* <- Const end
+103:     ST  0,-2(6) 	op: push argument(reverse order)
+* -> array
+104:    LDA  0,0(5) 	id : load address
+105:     ST  0,-3(6) 	op: push argument(reverse order)
+* 3 arguments are pushed
+106:    LDA  6,-3(6) 	stack growth after push arguments
+107:   CALL  6,-73(7) 	push return address and jump
+* <- call function sort end
+* -> compound 42 start
+* -> call function output
+* -> array
+* -> const 0
+* <- Const end
+108:     LD  0,0(5) 	get value
+109:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+110:    LDA  6,-1(6) 	stack growth after push arguments
+111:   CALL  6,-108(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 1
+* <- Const end
+112:     LD  0,1(5) 	get value
+113:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+114:    LDA  6,-1(6) 	stack growth after push arguments
+115:   CALL  6,-112(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 2
+* <- Const end
+116:     LD  0,2(5) 	get value
+117:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+118:    LDA  6,-1(6) 	stack growth after push arguments
+119:   CALL  6,-116(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 3
+* <- Const end
+120:     LD  0,3(5) 	get value
+121:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+122:    LDA  6,-1(6) 	stack growth after push arguments
+123:   CALL  6,-120(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 4
+* <- Const end
+124:     LD  0,4(5) 	get value
+125:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+126:    LDA  6,-1(6) 	stack growth after push arguments
+127:   CALL  6,-124(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 5
+* <- Const end
+128:     LD  0,5(5) 	get value
+129:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+130:    LDA  6,-1(6) 	stack growth after push arguments
+131:   CALL  6,-128(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 6
+* <- Const end
+132:     LD  0,6(5) 	get value
+133:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+134:    LDA  6,-1(6) 	stack growth after push arguments
+135:   CALL  6,-132(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 7
+* <- Const end
+136:     LD  0,7(5) 	get value
+137:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+138:    LDA  6,-1(6) 	stack growth after push arguments
+139:   CALL  6,-136(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 8
+* <- Const end
+140:     LD  0,8(5) 	get value
+141:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+142:    LDA  6,-1(6) 	stack growth after push arguments
+143:   CALL  6,-140(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> array
+* -> const 9
+* <- Const end
+144:     LD  0,9(5) 	get value
+145:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+146:    LDA  6,-1(6) 	stack growth after push arguments
+147:   CALL  6,-144(7) 	push return address and jump
+* <- call function output end
+* <- compound 42 end
+* <- compound 46 end
+148:  LEAVE  4,0(6) 	return: pop frame and fp
+149:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
@@ -0,0 +1,281 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_input, @function
+cm_input:
+	subq	$24, %rsp
+	leaq	.Lformat_in(%rip), %rdi
+	leaq	12(%rsp), %rsi
+	xorl	%eax, %eax
+	call	scanf@PLT
+	cmpl	$1, %eax
+	jne	.Lbad_input
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	ret
+.Lbad_input:
+	movl	$1, %edi
+	call	exit@PLT
+	.type	cm_sum, @function
+cm_sum:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+.Lsum_0:
+	movl	-4(%rbp), %eax
+	testl	%eax, %eax
+	jne	.Lsum_2
+.Lsum_1:
+	movl	-8(%rbp), %eax
+	leave
+	ret
+.Lsum_2:
+	movl	-8(%rbp), %eax
+	addl	-4(%rbp), %eax
+	movl	%eax, -12(%rbp)
+	movl	-4(%rbp), %eax
+	subl	$1, %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %edi
+	movl	-12(%rbp), %esi
+	leave
+	jmp	cm_sum
+	.type	cm_three, @function
+cm_three:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	movl	%edx, -12(%rbp)
+.Lthree_0:
+	movl	-4(%rbp), %eax
+	testl	%eax, %eax
+	jne	.Lthree_2
+.Lthree_1:
+	movl	-8(%rbp), %eax
+	addl	-12(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %eax
+	leave
+	ret
+.Lthree_2:
+	movl	0(%rbx), %eax
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -24(%rbp)
+	movl	-24(%rbp), %eax
+	movl	%eax, 0(%rbx)
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -28(%rbp)
+	movl	-4(%rbp), %eax
+	subl	$1, %eax
+	movl	%eax, -32(%rbp)
+	movl	-32(%rbp), %edi
+	movl	-12(%rbp), %esi
+	movl	-28(%rbp), %edx
+	leave
+	jmp	cm_three
+	.type	cm_one, @function
+cm_one:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movl	%edi, -4(%rbp)
+.Lone_0:
+	movl	-4(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -8(%rbp)
+	movl	-4(%rbp), %edi
+	movl	-8(%rbp), %esi
+	movl	$2, %edx
+	leave
+	jmp	cm_three
+	.type	cm_four, @function
+cm_four:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	movl	%edx, -12(%rbp)
+	movl	%ecx, -16(%rbp)
+.Lfour_0:
+	movl	-16(%rbp), %eax
+	testl	%eax, %eax
+	jle	.Lfour_2
+.Lfour_1:
+	movl	-16(%rbp), %eax
+	subl	$1, %eax
+	movl	%eax, -20(%rbp)
+	movl	-4(%rbp), %edi
+	movl	-8(%rbp), %esi
+	movl	-12(%rbp), %edx
+	movl	-20(%rbp), %ecx
+	leave
+	jmp	cm_four
+.Lfour_2:
+	movl	-4(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -28(%rbp)
+	movl	-28(%rbp), %eax
+	addl	-12(%rbp), %eax
+	movl	%eax, -32(%rbp)
+	movl	-32(%rbp), %edi
+	leave
+	jmp	cm_one
+	.type	cm_count, @function
+cm_count:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	movl	%edx, -12(%rbp)
+	movl	%ecx, -16(%rbp)
+.Lcount_0:
+	movl	-8(%rbp), %eax
+	subl	-12(%rbp), %eax
+	testl	%eax, %eax
+	jl	.Lcount_2
+.Lcount_1:
+	movl	-16(%rbp), %eax
+	leave
+	ret
+.Lcount_2:
+	movl	-4(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -20(%rbp)
+	movslq	-20(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -24(%rbp)
+	movl	-24(%rbp), %eax
+	testl	%eax, %eax
+	jle	.Lcount_4
+.Lcount_3:
+	movl	-16(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -28(%rbp)
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -32(%rbp)
+	movl	-4(%rbp), %edi
+	movl	-32(%rbp), %esi
+	movl	-12(%rbp), %edx
+	movl	-28(%rbp), %ecx
+	leave
+	jmp	cm_count
+.Lcount_4:
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -40(%rbp)
+	movl	-4(%rbp), %edi
+	movl	-40(%rbp), %esi
+	movl	-12(%rbp), %edx
+	movl	-16(%rbp), %ecx
+	leave
+	jmp	cm_count
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	subq	$4, %r12
+.Lmain_0:
+	call	cm_input
+	movl	%eax, -4(%rbp)
+	movl	-4(%rbp), %edi
+	movl	$0, %esi
+	call	cm_sum
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %edi
+	call	cm_output
+	movl	$0, %eax
+	movl	%eax, 0(%rbx)
+	movl	-4(%rbp), %edi
+	call	cm_one
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %edi
+	call	cm_output
+	movl	0(%rbx), %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %edi
+	call	cm_output
+	movl	$1, %edi
+	movl	$2, %esi
+	movl	$3, %edx
+	movl	-4(%rbp), %ecx
+	call	cm_four
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %edi
+	call	cm_output
+	leal	0(%r12), %eax
+	movl	%eax, -24(%rbp)
+	movl	$1, %eax
+	movslq	-24(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -28(%rbp)
+	movl	$-2, %eax
+	movslq	-28(%rbp), %rcx
+	movl	%eax, 4(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -32(%rbp)
+	movl	$3, %eax
+	movslq	-32(%rbp), %rcx
+	movl	%eax, 8(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -36(%rbp)
+	movl	$4, %eax
+	movslq	-36(%rbp), %rcx
+	movl	%eax, 12(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -40(%rbp)
+	movl	-40(%rbp), %edi
+	movl	$0, %esi
+	movl	$4, %edx
+	movl	$0, %ecx
+	call	cm_count
+	movl	%eax, -44(%rbp)
+	movl	-44(%rbp), %edi
+	call	cm_output
+	addq	$4, %r12
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
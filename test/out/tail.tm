@@ -0,0 +1,457 @@
+* TINY Compilation to TM Code
+* File: out/tail.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,129(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration input
+  7:     IN  0,0,0 	read integer value
+  8:    RET  6,0(0) 	return and pop arguments
+* <- function declaration input end
+* -> function declaration sum
+  9:  ENTER  4,0(6) 	push fp and allocate frame
+* register 3 holds n
+ 10:     LD  3,2(4) 	load parameter into register
+* register 2 holds s
+ 11:     LD  2,3(4) 	load parameter into register
+* -> compound 10 start
+* -> if start
+* -> condition
+* <- condition
+ 12:    JNE  3,3(7) 	if: jmp to else
+* -> Id
+ 13:    LDA  0,0(2) 	id: copy register
+* <- Id
+ 14:  LEAVE  4,0(6) 	return: pop frame and fp
+ 15:    RET  6,2(0) 	return and pop arguments
+* <- if end
+* -> tail call function sum
+* -> Op
+ 16:    LDA  0,-1(3) 	op +/- const
+* <- Op
+ 17:     ST  0,2(4) 	tail call: store argument
+* -> Op
+ 18:    ADD  0,2,3 	op +
+* <- Op
+ 19:     ST  0,3(4) 	tail call: store argument
+ 20:  LEAVE  4,0(6) 	tail call: pop frame and fp
+ 21:    LDA  7,-13(7) 	tail call: jump to function
+* <- tail call function sum end
+* <- compound 10 end
+* <- function declaration sum end
+* -> function declaration three
+ 22:  ENTER  4,0(6) 	push fp and allocate frame
+* register 3 holds a
+ 23:     LD  3,2(4) 	load parameter into register
+* register 2 holds b
+ 24:     LD  2,3(4) 	load parameter into register
+* -> compound 16 start
+* -> if start
+* -> condition
+* <- condition
+ 25:    JNE  3,4(7) 	if: jmp to else
+* -> Op
+* -> Id
+ 26:     LD  0,4(4) 	id: load value
+* <- Id
+ 27:    ADD  0,2,0 	op +
+* <- Op
+ 28:  LEAVE  4,0(6) 	return: pop frame and fp
+ 29:    RET  6,3(0) 	return and pop arguments
+* <- if end
+* -> assign to g
+* -> generate code for rhs
+* -> Op
+* -> Id
+ 30:     LD  0,0(5) 	id: load value
+* <- Id
+ 31:    LDA  0,1(0) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+ 32:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* -> tail call function three
+* -> Op
+ 33:    LDA  0,1(2) 	op +/- const
+* <- Op
+ 34:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> Id
+ 35:     LD  0,4(4) 	id: load value
+* <- Id
+ 36:     ST  0,-2(6) 	op: push argument(reverse order)
+* -> Op
+ 37:    LDA  0,-1(3) 	op +/- const
+* <- Op
+ 38:     ST  0,-3(6) 	op: push argument(reverse order)
+ 39:     LD  0,-1(6) 	tail call: load argument
+ 40:     ST  0,4(4) 	tail call: store argument
+ 41:     LD  0,-2(6) 	tail call: load argument
+ 42:     ST  0,3(4) 	tail call: store argument
+ 43:     LD  0,-3(6) 	tail call: load argument
+ 44:     ST  0,2(4) 	tail call: store argument
+ 45:  LEAVE  4,0(6) 	tail call: pop frame and fp
+ 46:    LDA  7,-25(7) 	tail call: jump to function
+* <- tail call function three end
+* <- compound 16 end
+* <- function declaration three end
+* -> function declaration four
+ 47:  ENTER  4,0(6) 	push fp and allocate frame
+* register 3 holds a
+ 48:     LD  3,2(4) 	load parameter into register
+* register 2 holds b
+ 49:     LD  2,3(4) 	load parameter into register
+* -> compound 25 start
+* -> if start
+* -> condition
+* -> Id
+ 50:     LD  0,5(4) 	id: load value
+* <- Id
+* <- condition
+ 51:    JLE  0,17(7) 	if: jmp to else
+* -> tail call function four
+* -> Op
+* -> Id
+ 52:     LD  0,5(4) 	id: load value
+* <- Id
+ 53:    LDA  0,-1(0) 	op +/- const
+* <- Op
+ 54:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> Id
+ 55:     LD  0,4(4) 	id: load value
+* <- Id
+ 56:     ST  0,-2(6) 	op: push argument(reverse order)
+ 57:     ST  2,-3(6) 	op: push argument(reverse order)
+ 58:     ST  3,-4(6) 	op: push argument(reverse order)
+ 59:     LD  0,-1(6) 	tail call: load argument
+ 60:     ST  0,5(4) 	tail call: store argument
+ 61:     LD  0,-2(6) 	tail call: load argument
+ 62:     ST  0,4(4) 	tail call: store argument
+ 63:     LD  0,-3(6) 	tail call: load argument
+ 64:     ST  0,3(4) 	tail call: store argument
+ 65:     LD  0,-4(6) 	tail call: load argument
+ 66:     ST  0,2(4) 	tail call: store argument
+ 67:  LEAVE  4,0(6) 	tail call: pop frame and fp
+ 68:    LDA  7,-22(7) 	tail call: jump to function
+* <- tail call function four end
+* <- if end
+* -> compound 24 start
+* register 3 holds one.a
+* -> assign to one.a
+* -> generate code for rhs
+* -> Op
+* -> left
+* -> Op
+ 69:    ADD  0,3,2 	op +
+* <- Op
+* <- left
+* -> right
+* -> Id
+ 70:     LD  1,4(4) 	id: load value
+* <- Id
+* <- right
+ 71:    ADD  0,0,1 	op +
+* <- Op
+* <- generate code for rhs end
+ 72:    LDA  3,0(0) 	assign: move to register
+* <- assign
+* -> compound 20 start
+* -> tail call function three
+ 73:     ST  3,3(4) 	tail call: store argument
+* -> Op
+ 74:    LDA  0,1(3) 	op +/- const
+* <- Op
+ 75:     ST  0,4(4) 	tail call: store argument
+* -> const 2
+ 76:    LDC  0,2(0) 	load const
+* <- Const end
+ 77:     ST  0,5(4) 	tail call: store argument
+ 78:     LD  1,1(4) 	tail call: load return address
+ 79:     ST  1,2(4) 	tail call: move return address
+ 80:    LDA  6,2(4) 	tail call: mp at return address
+ 81:     LD  4,0(4) 	tail call: restore fp
+ 82:    LDA  7,-61(7) 	tail call: jump to function
+* <- tail call function three end
+* <- compound 20 end
+* <- compound 24 end
+* <- compound 25 end
+ 83:  LEAVE  4,0(6) 	return: pop frame and fp
+ 84:    RET  6,4(0) 	return and pop arguments
+* <- function declaration four end
+* -> function declaration count
+ 85:  ENTER  4,0(6) 	push fp and allocate frame
+* register 3 holds i
+ 86:     LD  3,3(4) 	load parameter into register
+* register 2 holds n
+ 87:     LD  2,4(4) 	load parameter into register
+* -> compound 31 start
+* -> if start
+* -> condition
+ 88:    SUB  0,3,2 	condition: compare
+* <- condition
+ 89:    JLT  0,3(7) 	if: jmp to else
+* -> Id
+ 90:     LD  0,5(4) 	id: load value
+* <- Id
+ 91:  LEAVE  4,0(6) 	return: pop frame and fp
+ 92:    RET  6,4(0) 	return and pop arguments
+* <- if end
+* -> if start
+* -> condition
+* -> array
+ 93:     LD  1,2(4) 	load array parameter address
+ 94:    ADD  0,3,1 	index + array address
+ 95:     LD  0,0(0) 	get value
+* <- condition
+ 96:    JLE  0,18(7) 	if: jmp to else
+* -> tail call function count
+* -> Op
+* -> Id
+ 97:     LD  0,5(4) 	id: load value
+* <- Id
+ 98:    LDA  0,1(0) 	op +/- const
+* <- Op
+ 99:     ST  0,-1(6) 	op: push argument(reverse order)
+100:     ST  2,-2(6) 	op: push argument(reverse order)
+* -> Op
+101:    LDA  0,1(3) 	op +/- const
+* <- Op
+102:     ST  0,-3(6) 	op: push argument(reverse order)
+* -> Id
+103:     LD  0,2(4) 	id: load value
+* <- Id
+104:     ST  0,-4(6) 	op: push argument(reverse order)
+105:     LD  0,-1(6) 	tail call: load argument
+106:     ST  0,5(4) 	tail call: store argument
+107:     LD  0,-2(6) 	tail call: load argument
+108:     ST  0,4(4) 	tail call: store argument
+109:     LD  0,-3(6) 	tail call: load argument
+110:     ST  0,3(4) 	tail call: store argument
+111:     LD  0,-4(6) 	tail call: load argument
+112:     ST  0,2(4) 	tail call: store argument
+113:  LEAVE  4,0(6) 	tail call: pop frame and fp
+114:    LDA  7,-30(7) 	tail call: jump to function
+* <- tail call function count end
+* <- if end
+* -> tail call function count
+* -> Id
+115:     LD  0,5(4) 	id: load value
+* <- Id
+116:     ST  0,-1(6) 	op: push argument(reverse order)
+117:     ST  2,-2(6) 	op: push argument(reverse order)
+* -> Op
+118:    LDA  0,1(3) 	op +/- const
+* <- Op
+119:     ST  0,-3(6) 	op: push argument(reverse order)
+* -> Id
+120:     LD  0,2(4) 	id: load value
+* <- Id
+121:     ST  0,-4(6) 	op: push argument(reverse order)
+122:     LD  0,-1(6) 	tail call: load argument
+123:     ST  0,5(4) 	tail call: store argument
+124:     LD  0,-2(6) 	tail call: load argument
+125:     ST  0,4(4) 	tail call: store argument
+126:     LD  0,-3(6) 	tail call: load argument
+127:     ST  0,3(4) 	tail call: store argument
+128:     LD  0,-4(6) 	tail call: load argument
+129:     ST  0,2(4) 	tail call: store argument
+130:  LEAVE  4,0(6) 	tail call: pop frame and fp
+131:    LDA  7,-47(7) 	tail call: jump to function
+* <- tail call function count end
+* <- compound 31 end
+* <- function declaration count end
+* -> function declaration main
+132:  ENTER  4,5(6) 	push fp and allocate frame
+* -> compound 43 start
+* v is at -4(fp)
+* register 3 holds n
+* -> assign to n
+* -> generate code for rhs in place
+* -> call function input
+* 0 arguments are pushed
+133:   CALL  6,-127(7) 	push return address and jump
+134:    LDA  3,0(0) 	move return value
+* <- call function input end
+* <- generate code for rhs end
+* <- assign
+* -> call function output
+* -> call function sum
+* -> const 0
+135:    LDC  0,0(0) 	load const
+* <- Const end
+136:     ST  0,-1(6) 	op: push argument(reverse order)
+137:     ST  3,-2(6) 	op: push argument(reverse order)
+* 2 arguments are pushed
+138:     ST  3,-5(4) 	save register variable
+139:    LDA  6,-2(6) 	stack growth after push arguments
+140:   CALL  6,-132(7) 	push return address and jump
+141:     LD  3,-5(4) 	restore register variable
+* <- call function sum end
+142:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+143:     ST  3,-5(4) 	save register variable
+144:    LDA  6,-1(6) 	stack growth after push arguments
+145:   CALL  6,-142(7) 	push return address and jump
+146:     LD  3,-5(4) 	restore register variable
+* <- call function output end
+* -> assign to g
+* -> generate code for rhs
+* -> const 0
+147:    LDC  0,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+148:     ST  0,0(5) 	assign: store value
+* <- store value end
+* <- assign
+* -> call function output
+* -> call function three
+* -> const 2
+149:    LDC  0,2(0) 	load const
+* <- Const end
+150:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> Op
+151:    LDA  0,1(3) 	op +/- const
+* <- Op
+152:     ST  0,-2(6) 	op: push argument(reverse order)
+153:     ST  3,-3(6) 	op: push argument(reverse order)
+* 3 arguments are pushed
+154:     ST  3,-5(4) 	save register variable
+155:    LDA  6,-3(6) 	stack growth after push arguments
+156:   CALL  6,-135(7) 	push return address and jump
+157:     LD  3,-5(4) 	restore register variable
+* <- call function three end
+158:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+159:     ST  3,-5(4) 	save register variable
+160:    LDA  6,-1(6) 	stack growth after push arguments
+161:   CALL  6,-158(7) 	push return address and jump
+162:     LD  3,-5(4) 	restore register variable
+* <- call function output end
+* -> call function output
+* -> Id
+163:     LD  0,0(5) 	id: load value
+* <- Id
+164:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+165:     ST  3,-5(4) 	save register variable
+166:    LDA  6,-1(6) 	stack growth after push arguments
+167:   CALL  6,-164(7) 	push return address and jump
+168:     LD  3,-5(4) 	restore register variable
+* <- call function output end
+* -> call function output
+* -> call function four
+169:     ST  3,-1(6) 	op: push argument(reverse order)
+* -> const 3
+170:    LDC  0,3(0) 	load const
+* <- Const end
+171:     ST  0,-2(6) 	op: push argument(reverse order)
+* -> const 2
+172:    LDC  0,2(0) 	load const
+* <- Const end
+173:     ST  0,-3(6) 	op: push argument(reverse order)
+* -> const 1
+174:    LDC  0,1(0) 	load const
+* <- Const end
+175:     ST  0,-4(6) 	op: push argument(reverse order)
+* 4 arguments are pushed
+176:    LDA  6,-4(6) 	stack growth after push arguments
+177:   CALL  6,-131(7) 	push return address and jump
+* <- call function four end
+178:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+179:    LDA  6,-1(6) 	stack growth after push arguments
+180:   CALL  6,-177(7) 	push return address and jump
+* <- call function output end
+* -> assign to v
+* -> generate code for rhs
+* -> const 1
+181:    LDC  0,1(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+182:     ST  0,-4(4) 	store
+* <- store value end
+* <- assign
+* -> assign to v
+* -> generate code for rhs
+* -> const -2
+183:    LDC  0,-2(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+* <- Const end
+184:     ST  0,-3(4) 	store
+* <- store value end
+* <- assign
+* -> assign to v
+* -> generate code for rhs
+* -> const 3
+185:    LDC  0,3(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 2
+* <- Const end
+186:     ST  0,-2(4) 	store
+* <- store value end
+* <- assign
+* -> assign to v
+* -> generate code for rhs
+* -> const 4
+187:    LDC  0,4(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 3
+* <- Const end
+188:    LDA  1,3(4) 	index + local base
+189:     ST  0,-4(1) 	store
+* <- store value end
+* <- assign
+* -> call function output
+* -> call function count
+* -> const 0
+190:    LDC  0,0(0) 	load const
+* <- Const end
+191:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> const 4
+192:    LDC  0,4(0) 	load const
+* <- Const end
+193:     ST  0,-2(6) 	op: push argument(reverse order)
+* -> const 0
+194:    LDC  0,0(0) 	load const
+* <- Const end
+195:     ST  0,-3(6) 	op: push argument(reverse order)
+* -> array
+196:    LDA  0,-4(4) 	id : load address
+197:     ST  0,-4(6) 	op: push argument(reverse order)
+* 4 arguments are pushed
+198:    LDA  6,-4(6) 	stack growth after push arguments
+199:   CALL  6,-115(7) 	push return address and jump
+* <- call function count end
+200:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+201:    LDA  6,-1(6) 	stack growth after push arguments
+202:   CALL  6,-199(7) 	push return address and jump
+* <- call function output end
+* <- compound 43 end
+203:  LEAVE  4,0(6) 	return: pop frame and fp
+204:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
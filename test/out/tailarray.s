@@ -0,0 +1,217 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_readit, @function
+cm_readit:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$80, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	subq	$8, %r12
+.Lreadit_0:
+	movl	$0, %eax
+	movl	%eax, -12(%rbp)
+	movl	$0, %eax
+	movl	%eax, -16(%rbp)
+	jmp	.Lreadit_2
+.Lreadit_1:
+	leal	0(%r12), %eax
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %eax
+	addl	-12(%rbp), %eax
+	movl	%eax, -24(%rbp)
+	movl	$30, %eax
+	movslq	-24(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	movl	-12(%rbp), %eax
+	imull	-12(%rbp), %eax
+	movl	%eax, -28(%rbp)
+	movl	-16(%rbp), %eax
+	addl	-28(%rbp), %eax
+	movl	%eax, -32(%rbp)
+	movl	-12(%rbp), %eax
+	movl	$2, %ecx
+	cltd
+	idivl	%ecx
+	movl	%eax, -36(%rbp)
+	movl	-32(%rbp), %eax
+	subl	-36(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-12(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -12(%rbp)
+.Lreadit_2:
+	movl	-12(%rbp), %eax
+	subl	$8, %eax
+	testl	%eax, %eax
+	jl	.Lreadit_1
+.Lreadit_3:
+	movslq	-4(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -40(%rbp)
+	movslq	-4(%rbp), %rcx
+	movl	4(%rbx,%rcx,4), %eax
+	movl	%eax, -44(%rbp)
+	movl	-40(%rbp), %eax
+	addl	-44(%rbp), %eax
+	movl	%eax, -48(%rbp)
+	leal	0(%r12), %eax
+	movl	%eax, -52(%rbp)
+	movl	-52(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -56(%rbp)
+	movslq	-56(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -60(%rbp)
+	movl	-8(%rbp), %eax
+	imull	-60(%rbp), %eax
+	movl	%eax, -64(%rbp)
+	movl	-48(%rbp), %eax
+	addl	-64(%rbp), %eax
+	movl	%eax, -68(%rbp)
+	movl	-68(%rbp), %eax
+	addl	-16(%rbp), %eax
+	movl	%eax, -72(%rbp)
+	movl	-72(%rbp), %eax
+	subl	$128, %eax
+	movl	%eax, -76(%rbp)
+	movl	-76(%rbp), %eax
+	addq	$8, %r12
+	leave
+	ret
+	.type	cm_local, @function
+cm_local:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movl	%edi, -4(%rbp)
+	subq	$4, %r12
+.Llocal_0:
+	leal	0(%r12), %eax
+	movl	%eax, -8(%rbp)
+	movl	$5, %eax
+	movslq	-8(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -12(%rbp)
+	movl	$7, %eax
+	movslq	-12(%rbp), %rcx
+	movl	%eax, 4(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %edi
+	movl	-4(%rbp), %esi
+	call	cm_readit
+	movl	%eax, -20(%rbp)
+	movl	-20(%rbp), %eax
+	addq	$4, %r12
+	leave
+	ret
+	.type	cm_param, @function
+cm_param:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	subq	$4, %r12
+.Lparam_0:
+	leal	0(%r12), %eax
+	movl	%eax, -12(%rbp)
+	movl	-8(%rbp), %eax
+	movslq	-12(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -16(%rbp)
+	movslq	-16(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -20(%rbp)
+	movl	-4(%rbp), %edi
+	movl	-20(%rbp), %esi
+	addq	$4, %r12
+	leave
+	jmp	cm_readit
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	subq	$2, %r12
+.Lmain_0:
+	movl	$0, %edi
+	call	cm_local
+	movl	%eax, -4(%rbp)
+	movl	-4(%rbp), %edi
+	call	cm_output
+	movl	$1, %edi
+	call	cm_local
+	movl	%eax, -8(%rbp)
+	movl	-8(%rbp), %edi
+	call	cm_output
+	movl	$1, %eax
+	movl	%eax, 0(%rbx)
+	movl	$2, %eax
+	movl	%eax, 4(%rbx)
+	movl	$0, %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %edi
+	movl	$1, %esi
+	call	cm_param
+	movl	%eax, -16(%rbp)
+	movl	-16(%rbp), %edi
+	call	cm_output
+	leal	0(%r12), %eax
+	movl	%eax, -20(%rbp)
+	movl	$3, %eax
+	movslq	-20(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -24(%rbp)
+	movl	$4, %eax
+	movslq	-24(%rbp), %rcx
+	movl	%eax, 4(%rbx,%rcx,4)
+	leal	0(%r12), %eax
+	movl	%eax, -28(%rbp)
+	movl	-28(%rbp), %edi
+	movl	$2, %esi
+	call	cm_param
+	movl	%eax, -32(%rbp)
+	movl	-32(%rbp), %edi
+	call	cm_output
+	addq	$2, %r12
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
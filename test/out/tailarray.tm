@@ -0,0 +1,628 @@
+* TINY Compilation to TM Code
+* File: out/tailarray.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,88(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration local
+  7:  ENTER  4,12(6) 	push fp and allocate frame
+* register 2 holds n
+  8:     LD  2,2(4) 	load parameter into register
+* -> compound 22 start
+* a is at -12(fp)
+* -> assign to a
+* -> generate code for rhs
+* -> const 5
+  9:    LDC  0,5(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+ 10:     ST  0,-12(4) 	store
+* <- store value end
+* <- assign
+* -> assign to a
+* -> generate code for rhs
+* -> const 7
+ 11:    LDC  0,7(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+* <- Const end
+ 12:     ST  0,-11(4) 	store
+* <- store value end
+* <- assign
+* -> compound 21 start
+* -> compound 16 start
+* readit.c is at -8(fp)
+* register 3 holds readit.s
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> const 0
+ 13:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> compound 10 start
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+ 14:    LDC  0,30(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+ 15:     ST  0,-8(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs
+* -> Id
+* <- Id
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+* <- Const end
+ 16:     ST  0,-7(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 17:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 2
+* <- Const end
+ 18:     ST  0,-6(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 19:    LDA  3,3(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 3
+* <- Const end
+ 20:     ST  0,-5(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 21:    LDA  3,8(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 4
+* <- Const end
+ 22:     ST  0,-4(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 23:    LDA  3,14(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 5
+* <- Const end
+ 24:     ST  0,-3(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 25:    LDA  3,23(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 6
+* <- Const end
+ 26:     ST  0,-2(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 27:    LDA  3,33(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 7
+* <- Const end
+ 28:     ST  0,-1(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 29:    LDA  3,46(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 10 end
+* -> Op
+* -> Op
+* -> Op
+* -> left
+* -> Op
+* -> left
+* -> array
+* -> const 0
+* <- Const end
+ 30:     LD  0,-12(4) 	get value
+* <- left
+ 31:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+* -> const 1
+* <- Const end
+ 32:     LD  0,-11(4) 	get value
+* <- right
+ 33:     LD  1,-1(6) 	op: reload operand
+ 34:    ADD  0,1,0 	op +
+* <- Op
+* <- left
+ 35:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> Op
+* -> array
+ 36:    ADD  0,2,4 	index + local base
+ 37:     LD  0,-8(0) 	get value
+ 38:    MUL  0,2,0 	op *
+* <- Op
+* <- right
+ 39:     LD  1,-1(6) 	op: reload operand
+ 40:    ADD  0,1,0 	op +
+* <- Op
+ 41:    ADD  0,0,3 	op +
+* <- Op
+ 42:    LDA  0,-128(0) 	op +/- const
+* <- Op
+ 43:  LEAVE  4,0(6) 	return: pop frame and fp
+ 44:    RET  6,1(0) 	return and pop arguments
+* <- compound 16 end
+* <- compound 21 end
+* <- compound 22 end
+ 45:  LEAVE  4,0(6) 	return: pop frame and fp
+ 46:    RET  6,1(0) 	return and pop arguments
+* <- function declaration local end
+* -> function declaration param
+ 47:  ENTER  4,12(6) 	push fp and allocate frame
+* -> compound 28 start
+* a is at -12(fp)
+* -> assign to a
+* -> generate code for rhs
+* -> Id
+ 48:     LD  0,3(4) 	id: load value
+* <- Id
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+ 49:     ST  0,-12(4) 	store
+* <- store value end
+* <- assign
+* -> compound 27 start
+* register 2 holds readit.n
+* -> assign to readit.n
+* -> generate code for rhs in place
+* -> array
+* -> const 0
+* <- Const end
+ 50:    LDA  2,0(0) 	get value
+* <- generate code for rhs end
+* <- assign
+* -> compound 16 start
+* readit.c is at -8(fp)
+* register 3 holds readit.s
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> const 0
+ 51:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> compound 10 start
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+ 52:    LDC  0,30(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+ 53:     ST  0,-8(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs
+* -> Id
+* <- Id
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+* <- Const end
+ 54:     ST  0,-7(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 55:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 2
+* <- Const end
+ 56:     ST  0,-6(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 57:    LDA  3,3(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 3
+* <- Const end
+ 58:     ST  0,-5(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 59:    LDA  3,8(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 4
+* <- Const end
+ 60:     ST  0,-4(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 61:    LDA  3,14(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 5
+* <- Const end
+ 62:     ST  0,-3(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 63:    LDA  3,23(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 6
+* <- Const end
+ 64:     ST  0,-2(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 65:    LDA  3,33(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to readit.c
+* -> generate code for rhs
+* -> const 30
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 7
+* <- Const end
+ 66:     ST  0,-1(4) 	store
+* <- store value end
+* <- assign
+* -> assign to readit.s
+* -> generate code for rhs in place
+* -> Op
+ 67:    LDA  3,46(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 10 end
+* -> Op
+* -> Op
+* -> Op
+* -> left
+* -> Op
+* -> left
+* -> array
+* -> const 0
+ 68:    LDC  0,0(0) 	load const
+* <- Const end
+ 69:     LD  1,2(4) 	load array parameter address
+ 70:    ADD  0,0,1 	index + array address
+ 71:     LD  0,0(0) 	get value
+* <- left
+ 72:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+* -> const 1
+ 73:    LDC  0,1(0) 	load const
+* <- Const end
+ 74:     LD  1,2(4) 	load array parameter address
+ 75:    ADD  0,0,1 	index + array address
+ 76:     LD  0,0(0) 	get value
+* <- right
+ 77:     LD  1,-1(6) 	op: reload operand
+ 78:    ADD  0,1,0 	op +
+* <- Op
+* <- left
+ 79:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> Op
+* -> array
+ 80:    ADD  0,2,4 	index + local base
+ 81:     LD  0,-8(0) 	get value
+ 82:    MUL  0,2,0 	op *
+* <- Op
+* <- right
+ 83:     LD  1,-1(6) 	op: reload operand
+ 84:    ADD  0,1,0 	op +
+* <- Op
+ 85:    ADD  0,0,3 	op +
+* <- Op
+ 86:    LDA  0,-128(0) 	op +/- const
+* <- Op
+ 87:  LEAVE  4,0(6) 	return: pop frame and fp
+ 88:    RET  6,2(0) 	return and pop arguments
+* <- compound 16 end
+* <- compound 27 end
+* <- compound 28 end
+ 89:  LEAVE  4,0(6) 	return: pop frame and fp
+ 90:    RET  6,2(0) 	return and pop arguments
+* <- function declaration param end
+* -> function declaration main
+ 91:  ENTER  4,2(6) 	push fp and allocate frame
+* -> compound 38 start
+* a is at -2(fp)
+* -> call function output
+* -> call function local
+* -> const 0
+ 92:    LDC  0,0(0) 	load const
+* <- Const end
+ 93:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 94:    LDA  6,-1(6) 	stack growth after push arguments
+ 95:   CALL  6,-89(7) 	push return address and jump
+* <- call function local end
+ 96:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 97:    LDA  6,-1(6) 	stack growth after push arguments
+ 98:   CALL  6,-95(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> call function local
+* -> const 1
+ 99:    LDC  0,1(0) 	load const
+* <- Const end
+100:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+101:    LDA  6,-1(6) 	stack growth after push arguments
+102:   CALL  6,-96(7) 	push return address and jump
+* <- call function local end
+103:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+104:    LDA  6,-1(6) 	stack growth after push arguments
+105:   CALL  6,-102(7) 	push return address and jump
+* <- call function output end
+* -> assign to g
+* -> generate code for rhs
+* -> const 1
+106:    LDC  0,1(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+107:     ST  0,0(5) 	store
+* <- store value end
+* <- assign
+* -> assign to g
+* -> generate code for rhs
+* -> const 2
+108:    LDC  0,2(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+109:    LDC  1,1(0) 	load const
+* <- Const end
+110:     ST  0,0(1) 	store
+* <- store value end
+* <- assign
+* -> call function output
+* -> call function param
+* -> const 1
+111:    LDC  0,1(0) 	load const
+* <- Const end
+112:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> array
+113:    LDA  0,0(5) 	id : load address
+114:     ST  0,-2(6) 	op: push argument(reverse order)
+* 2 arguments are pushed
+115:    LDA  6,-2(6) 	stack growth after push arguments
+116:   CALL  6,-70(7) 	push return address and jump
+* <- call function param end
+117:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+118:    LDA  6,-1(6) 	stack growth after push arguments
+119:   CALL  6,-116(7) 	push return address and jump
+* <- call function output end
+* -> assign to a
+* -> generate code for rhs
+* -> const 3
+120:    LDC  0,3(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 0
+* <- Const end
+121:     ST  0,-2(4) 	store
+* <- store value end
+* <- assign
+* -> assign to a
+* -> generate code for rhs
+* -> const 4
+122:    LDC  0,4(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* -> store value start
+* -> array
+* -> const 1
+* <- Const end
+123:    LDA  1,1(4) 	index + local base
+124:     ST  0,-2(1) 	store
+* <- store value end
+* <- assign
+* -> call function output
+* -> call function param
+* -> const 2
+125:    LDC  0,2(0) 	load const
+* <- Const end
+126:     ST  0,-1(6) 	op: push argument(reverse order)
+* -> array
+127:    LDA  0,-2(4) 	id : load address
+128:     ST  0,-2(6) 	op: push argument(reverse order)
+* 2 arguments are pushed
+129:    LDA  6,-2(6) 	stack growth after push arguments
+130:   CALL  6,-84(7) 	push return address and jump
+* <- call function param end
+131:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+132:    LDA  6,-1(6) 	stack growth after push arguments
+133:   CALL  6,-130(7) 	push return address and jump
+* <- call function output end
+* <- compound 38 end
+134:  LEAVE  4,0(6) 	return: pop frame and fp
+135:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
@@ -0,0 +1,211 @@
+	.section	.rodata
+.Lformat_in:
+	.string	"%d"
+.Lformat_out:
+	.string	"%d\n"
+	.bss
+	.align	16
+memory:
+	.zero	4194304
+	.text
+	.globl	main
+	.type	main, @function
+main:
+	pushq	%rbx
+	pushq	%r12
+	pushq	%rbp
+	leaq	memory(%rip), %rbx
+	movq	$1048576, %r12
+	call	cm_main
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%rbx
+	ret
+	.type	cm_output, @function
+cm_output:
+	subq	$8, %rsp
+	movl	%edi, %esi
+	leaq	.Lformat_out(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	fflush@PLT
+	addq	$8, %rsp
+	ret
+	.type	cm_input, @function
+cm_input:
+	subq	$24, %rsp
+	leaq	.Lformat_in(%rip), %rdi
+	leaq	12(%rsp), %rsi
+	xorl	%eax, %eax
+	call	scanf@PLT
+	cmpl	$1, %eax
+	jne	.Lbad_input
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	ret
+.Lbad_input:
+	movl	$1, %edi
+	call	exit@PLT
+	.type	cm_main, @function
+cm_main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+.Lmain_0:
+	call	cm_input
+	movl	%eax, -4(%rbp)
+	movl	$0, %eax
+	movl	%eax, -8(%rbp)
+	jmp	.Lmain_2
+.Lmain_1:
+	movl	-8(%rbp), %eax
+	imull	-4(%rbp), %eax
+	movl	%eax, -12(%rbp)
+	movl	-12(%rbp), %eax
+	movslq	-8(%rbp), %rcx
+	movl	%eax, 0(%rbx,%rcx,4)
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -8(%rbp)
+.Lmain_2:
+	movl	-8(%rbp), %eax
+	subl	$103, %eax
+	testl	%eax, %eax
+	jl	.Lmain_1
+.Lmain_3:
+	movl	$0, %eax
+	movl	%eax, -8(%rbp)
+	movl	$0, %eax
+	movl	%eax, -16(%rbp)
+	jmp	.Lmain_5
+.Lmain_4:
+	movslq	-8(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -20(%rbp)
+	movl	-16(%rbp), %eax
+	addl	-20(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-8(%rbp), %eax
+	addl	$2, %eax
+	movl	%eax, -8(%rbp)
+.Lmain_5:
+	movl	-8(%rbp), %eax
+	subl	$100, %eax
+	testl	%eax, %eax
+	jle	.Lmain_4
+.Lmain_6:
+	movl	-16(%rbp), %edi
+	call	cm_output
+	movl	-8(%rbp), %edi
+	call	cm_output
+	movl	$102, %eax
+	movl	%eax, -8(%rbp)
+	movl	$0, %eax
+	movl	%eax, -16(%rbp)
+	jmp	.Lmain_8
+.Lmain_7:
+	movslq	-8(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -24(%rbp)
+	movl	-16(%rbp), %eax
+	addl	-24(%rbp), %eax
+	movl	%eax, -28(%rbp)
+	movslq	-8(%rbp), %rcx
+	movl	-4(%rbx,%rcx,4), %eax
+	movl	%eax, -32(%rbp)
+	movl	-28(%rbp), %eax
+	subl	-32(%rbp), %eax
+	movl	%eax, -16(%rbp)
+	movl	-8(%rbp), %eax
+	subl	$3, %eax
+	movl	%eax, -8(%rbp)
+.Lmain_8:
+	movl	-8(%rbp), %eax
+	subl	$3, %eax
+	testl	%eax, %eax
+	jg	.Lmain_7
+.Lmain_9:
+	movl	-16(%rbp), %edi
+	call	cm_output
+	movl	-8(%rbp), %edi
+	call	cm_output
+	movl	$5, %eax
+	movl	%eax, -8(%rbp)
+	movl	$0, %eax
+	movl	%eax, -36(%rbp)
+	jmp	.Lmain_11
+.Lmain_10:
+	movl	-36(%rbp), %eax
+	addl	-8(%rbp), %eax
+	movl	%eax, -36(%rbp)
+	movl	-8(%rbp), %eax
+	addl	$5, %eax
+	movl	%eax, -8(%rbp)
+.Lmain_11:
+	movl	-8(%rbp), %eax
+	subl	$65, %eax
+	testl	%eax, %eax
+	jne	.Lmain_10
+.Lmain_12:
+	movl	-36(%rbp), %edi
+	call	cm_output
+	movl	-8(%rbp), %edi
+	call	cm_output
+	movl	$0, %eax
+	movl	%eax, -8(%rbp)
+	movl	$0, %eax
+	movl	%eax, -36(%rbp)
+	jmp	.Lmain_17
+.Lmain_13:
+	movslq	-8(%rbp), %rcx
+	movl	0(%rbx,%rcx,4), %eax
+	movl	%eax, -40(%rbp)
+	movl	-40(%rbp), %eax
+	subl	$50, %eax
+	testl	%eax, %eax
+	jle	.Lmain_15
+.Lmain_14:
+	movl	-36(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -36(%rbp)
+	jmp	.Lmain_16
+.Lmain_15:
+	movl	-36(%rbp), %eax
+	addl	$2, %eax
+	movl	%eax, -36(%rbp)
+	movl	-8(%rbp), %edi
+	call	cm_output
+.Lmain_16:
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -8(%rbp)
+.Lmain_17:
+	movl	-8(%rbp), %eax
+	subl	$40, %eax
+	testl	%eax, %eax
+	jl	.Lmain_13
+.Lmain_18:
+	movl	-36(%rbp), %edi
+	call	cm_output
+	movl	$7, %eax
+	movl	%eax, -8(%rbp)
+	jmp	.Lmain_20
+.Lmain_19:
+	movl	$999, %edi
+	call	cm_output
+	movl	-8(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, -8(%rbp)
+.Lmain_20:
+	movl	-8(%rbp), %eax
+	subl	$3, %eax
+	testl	%eax, %eax
+	jl	.Lmain_19
+.Lmain_21:
+	movl	-8(%rbp), %edi
+	call	cm_output
+	leave
+	ret
+	.section	.note.GNU-stack,"",@progbits
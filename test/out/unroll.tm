@@ -0,0 +1,757 @@
+* TINY Compilation to TM Code
+* File: out/unroll.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+* End of standard prelude.
+  2:   CALL  6,6(7) 	call main
+* End of execution.
+  3:   HALT  0,0,0 	done
+* -> function declaration output
+  4:     LD  0,1(6) 	load first argument
+  5:    OUT  0,0,0 	write ac
+  6:    RET  6,1(0) 	return and pop arguments
+* <- function declaration output end
+* -> function declaration input
+  7:     IN  0,0,0 	read integer value
+  8:    RET  6,0(0) 	return and pop arguments
+* <- function declaration input end
+* -> function declaration main
+  9:  ENTER  4,2(6) 	push fp and allocate frame
+* -> compound 25 start
+* register 3 holds i
+* register 2 holds s
+* register 2 holds k
+* register 2 holds n
+* -> assign to n
+* -> generate code for rhs in place
+* -> call function input
+* 0 arguments are pushed
+ 10:   CALL  6,-4(7) 	push return address and jump
+ 11:    LDA  2,0(0) 	move return value
+* <- call function input end
+* <- generate code for rhs end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> const 0
+ 12:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> while start
+ 13:    LDA  7,12(7) 	while : jump to test
+* while : body start
+* -> compound 9 start
+* -> assign to a
+* -> generate code for rhs
+* -> Op
+ 14:    MUL  0,3,2 	op *
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+* -> array
+ 15:     ST  0,0(3) 	store
+* <- store value end
+* <- assign
+* -> assign to a
+* -> generate code for rhs
+* -> Op
+* -> Op
+ 16:    LDA  0,1(3) 	op +/- const
+* <- Op
+ 17:    MUL  0,0,2 	op *
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+* -> array
+ 18:     ST  0,1(3) 	store
+* <- store value end
+* <- assign
+* -> assign to a
+* -> generate code for rhs
+* -> Op
+* -> Op
+ 19:    LDA  0,2(3) 	op +/- const
+* <- Op
+ 20:    MUL  0,0,2 	op *
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+* -> array
+ 21:     ST  0,2(3) 	store
+* <- store value end
+* <- assign
+* -> assign to a
+* -> generate code for rhs
+* -> Op
+* -> Op
+ 22:    LDA  0,3(3) 	op +/- const
+* <- Op
+ 23:    MUL  0,0,2 	op *
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+* -> array
+ 24:     ST  0,3(3) 	store
+* <- store value end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 25:    LDA  3,4(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 9 end
+* while : body end
+* while : test expression start
+* -> condition
+ 26:    LDA  0,-100(3) 	condition: compare
+* <- condition
+ 27:    JLT  0,-14(7) 	while : true
+* while : test expression end
+* -> while start
+ 28:    LDA  7,3(7) 	while : jump to test
+* while : body start
+* -> compound 9 start
+* -> assign to a
+* -> generate code for rhs
+* -> Op
+ 29:    MUL  0,3,2 	op *
+* <- Op
+* <- generate code for rhs end
+* -> store value start
+* -> array
+ 30:     ST  0,0(3) 	store
+* <- store value end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 31:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 9 end
+* while : body end
+* while : test expression start
+* -> condition
+ 32:    LDA  0,-103(3) 	condition: compare
+* <- condition
+ 33:    JLT  0,-5(7) 	while : true
+* while : test expression end
+* -> assign to i
+* -> generate code for rhs in place
+* -> const 0
+ 34:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> assign to s
+* -> generate code for rhs in place
+* -> const 0
+ 35:    LDC  2,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> while start
+ 36:    LDA  7,9(7) 	while : jump to test
+* while : body start
+* -> compound 11 start
+* -> assign to s
+* -> generate code for rhs in place
+* -> Op
+* -> array
+ 37:     LD  0,0(3) 	get value
+ 38:    ADD  2,2,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to s
+* -> generate code for rhs in place
+* -> Op
+* -> array
+ 39:     LD  0,2(3) 	get value
+ 40:    ADD  2,2,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to s
+* -> generate code for rhs in place
+* -> Op
+* -> array
+ 41:     LD  0,4(3) 	get value
+ 42:    ADD  2,2,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to s
+* -> generate code for rhs in place
+* -> Op
+* -> array
+ 43:     LD  0,6(3) 	get value
+ 44:    ADD  2,2,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 45:    LDA  3,8(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 11 end
+* while : body end
+* while : test expression start
+* -> condition
+ 46:    LDA  0,-96(3) 	condition: compare
+* <- condition
+ 47:    JLT  0,-11(7) 	while : true
+* while : test expression end
+* -> while start
+ 48:    LDA  7,3(7) 	while : jump to test
+* while : body start
+* -> compound 11 start
+* -> assign to s
+* -> generate code for rhs in place
+* -> Op
+* -> array
+ 49:     LD  0,0(3) 	get value
+ 50:    ADD  2,2,0 	op +
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 51:    LDA  3,2(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 11 end
+* while : body end
+* while : test expression start
+* -> condition
+ 52:    LDA  0,-100(3) 	condition: compare
+* <- condition
+ 53:    JLE  0,-5(7) 	while : true
+* while : test expression end
+* -> call function output
+ 54:     ST  2,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 55:     ST  3,-1(4) 	save register variable
+ 56:    LDA  6,-1(6) 	stack growth after push arguments
+ 57:   CALL  6,-54(7) 	push return address and jump
+ 58:     LD  3,-1(4) 	restore register variable
+* <- call function output end
+* -> call function output
+ 59:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+ 60:    LDA  6,-1(6) 	stack growth after push arguments
+ 61:   CALL  6,-58(7) 	push return address and jump
+* <- call function output end
+* -> assign to i
+* -> generate code for rhs in place
+* -> const 102
+ 62:    LDC  3,102(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> assign to s
+* -> generate code for rhs in place
+* -> const 0
+ 63:    LDC  2,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> while start
+ 64:    LDA  7,29(7) 	while : jump to test
+* while : body start
+* -> compound 14 start
+* -> assign to s
+* -> generate code for rhs
+* -> Op
+* -> left
+* -> Op
+* -> array
+ 65:     LD  0,0(3) 	get value
+ 66:    ADD  0,2,0 	op +
+* <- Op
+* <- left
+ 67:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+ 68:     LD  0,-1(3) 	get value
+* <- right
+ 69:     LD  1,-1(6) 	op: reload operand
+ 70:    SUB  0,1,0 	op -
+* <- Op
+* <- generate code for rhs end
+ 71:    LDA  2,0(0) 	assign: move to register
+* <- assign
+* -> assign to s
+* -> generate code for rhs
+* -> Op
+* -> left
+* -> Op
+* -> array
+ 72:     LD  0,-3(3) 	get value
+ 73:    ADD  0,2,0 	op +
+* <- Op
+* <- left
+ 74:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+ 75:     LD  0,-4(3) 	get value
+* <- right
+ 76:     LD  1,-1(6) 	op: reload operand
+ 77:    SUB  0,1,0 	op -
+* <- Op
+* <- generate code for rhs end
+ 78:    LDA  2,0(0) 	assign: move to register
+* <- assign
+* -> assign to s
+* -> generate code for rhs
+* -> Op
+* -> left
+* -> Op
+* -> array
+ 79:     LD  0,-6(3) 	get value
+ 80:    ADD  0,2,0 	op +
+* <- Op
+* <- left
+ 81:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+ 82:     LD  0,-7(3) 	get value
+* <- right
+ 83:     LD  1,-1(6) 	op: reload operand
+ 84:    SUB  0,1,0 	op -
+* <- Op
+* <- generate code for rhs end
+ 85:    LDA  2,0(0) 	assign: move to register
+* <- assign
+* -> assign to s
+* -> generate code for rhs
+* -> Op
+* -> left
+* -> Op
+* -> array
+ 86:     LD  0,-9(3) 	get value
+ 87:    ADD  0,2,0 	op +
+* <- Op
+* <- left
+ 88:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+ 89:     LD  0,-10(3) 	get value
+* <- right
+ 90:     LD  1,-1(6) 	op: reload operand
+ 91:    SUB  0,1,0 	op -
+* <- Op
+* <- generate code for rhs end
+ 92:    LDA  2,0(0) 	assign: move to register
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+ 93:    LDA  3,-12(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 14 end
+* while : body end
+* while : test expression start
+* -> condition
+ 94:    LDA  0,-6(3) 	condition: compare
+* <- condition
+ 95:    JGT  0,-31(7) 	while : true
+* while : test expression end
+* -> while start
+ 96:    LDA  7,8(7) 	while : jump to test
+* while : body start
+* -> compound 14 start
+* -> assign to s
+* -> generate code for rhs
+* -> Op
+* -> left
+* -> Op
+* -> array
+ 97:     LD  0,0(3) 	get value
+ 98:    ADD  0,2,0 	op +
+* <- Op
+* <- left
+ 99:     ST  0,-1(6) 	op: spill operand
+* -> right
+* -> array
+100:     LD  0,-1(3) 	get value
+* <- right
+101:     LD  1,-1(6) 	op: reload operand
+102:    SUB  0,1,0 	op -
+* <- Op
+* <- generate code for rhs end
+103:    LDA  2,0(0) 	assign: move to register
+* <- assign
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+104:    LDA  3,-3(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 14 end
+* while : body end
+* while : test expression start
+* -> condition
+105:    LDA  0,-3(3) 	condition: compare
+* <- condition
+106:    JGT  0,-10(7) 	while : true
+* while : test expression end
+* -> call function output
+107:     ST  2,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+108:     ST  3,-1(4) 	save register variable
+109:    LDA  6,-1(6) 	stack growth after push arguments
+110:   CALL  6,-107(7) 	push return address and jump
+111:     LD  3,-1(4) 	restore register variable
+* <- call function output end
+* -> call function output
+112:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+113:    LDA  6,-1(6) 	stack growth after push arguments
+114:   CALL  6,-111(7) 	push return address and jump
+* <- call function output end
+* -> assign to k
+* -> generate code for rhs in place
+* -> const 0
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> compound 17 start
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+115:    LDA  2,390(5) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 17 end
+* -> call function output
+116:     ST  2,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+117:    LDA  6,-1(6) 	stack growth after push arguments
+118:   CALL  6,-115(7) 	push return address and jump
+* <- call function output end
+* -> call function output
+* -> const 65
+119:    LDC  0,65(0) 	load const
+* <- Const end
+120:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+121:    LDA  6,-1(6) 	stack growth after push arguments
+122:   CALL  6,-119(7) 	push return address and jump
+* <- call function output end
+* -> assign to i
+* -> generate code for rhs in place
+* -> const 0
+123:    LDC  3,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> assign to k
+* -> generate code for rhs in place
+* -> const 0
+124:    LDC  2,0(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> while start
+125:    LDA  7,60(7) 	while : jump to test
+* while : body start
+* -> compound 20 start
+* -> if start
+* -> condition
+* -> array
+126:     LD  0,0(3) 	get value
+127:    LDC  1,50(0) 	load const operand
+128:    SUB  0,0,1 	condition: compare
+* <- condition
+129:    JGT  0,9(7) 	if: jmp to then
+* -> compound 20 start
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+130:    LDA  2,2(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> call function output
+131:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+132:     ST  3,-1(4) 	save register variable
+133:     ST  2,-2(4) 	save register variable
+134:    LDA  6,-1(6) 	stack growth after push arguments
+135:   CALL  6,-132(7) 	push return address and jump
+136:     LD  3,-1(4) 	restore register variable
+137:     LD  2,-2(4) 	restore register variable
+* <- call function output end
+* <- compound 20 end
+138:    LDA  7,1(7) 	jmp to end
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+139:    LDA  2,1(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- if end
+* -> if start
+* -> condition
+* -> array
+140:     LD  0,1(3) 	get value
+141:    LDC  1,50(0) 	load const operand
+142:    SUB  0,0,1 	condition: compare
+* <- condition
+143:    JGT  0,10(7) 	if: jmp to then
+* -> compound 20 start
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+144:    LDA  2,2(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> call function output
+* -> Op
+145:    LDA  0,1(3) 	op +/- const
+* <- Op
+146:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+147:     ST  3,-1(4) 	save register variable
+148:     ST  2,-2(4) 	save register variable
+149:    LDA  6,-1(6) 	stack growth after push arguments
+150:   CALL  6,-147(7) 	push return address and jump
+151:     LD  3,-1(4) 	restore register variable
+152:     LD  2,-2(4) 	restore register variable
+* <- call function output end
+* <- compound 20 end
+153:    LDA  7,1(7) 	jmp to end
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+154:    LDA  2,1(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- if end
+* -> if start
+* -> condition
+* -> array
+155:     LD  0,2(3) 	get value
+156:    LDC  1,50(0) 	load const operand
+157:    SUB  0,0,1 	condition: compare
+* <- condition
+158:    JGT  0,10(7) 	if: jmp to then
+* -> compound 20 start
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+159:    LDA  2,2(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> call function output
+* -> Op
+160:    LDA  0,2(3) 	op +/- const
+* <- Op
+161:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+162:     ST  3,-1(4) 	save register variable
+163:     ST  2,-2(4) 	save register variable
+164:    LDA  6,-1(6) 	stack growth after push arguments
+165:   CALL  6,-162(7) 	push return address and jump
+166:     LD  3,-1(4) 	restore register variable
+167:     LD  2,-2(4) 	restore register variable
+* <- call function output end
+* <- compound 20 end
+168:    LDA  7,1(7) 	jmp to end
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+169:    LDA  2,1(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- if end
+* -> if start
+* -> condition
+* -> array
+170:     LD  0,3(3) 	get value
+171:    LDC  1,50(0) 	load const operand
+172:    SUB  0,0,1 	condition: compare
+* <- condition
+173:    JGT  0,10(7) 	if: jmp to then
+* -> compound 20 start
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+174:    LDA  2,2(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* -> call function output
+* -> Op
+175:    LDA  0,3(3) 	op +/- const
+* <- Op
+176:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+177:     ST  3,-1(4) 	save register variable
+178:     ST  2,-2(4) 	save register variable
+179:    LDA  6,-1(6) 	stack growth after push arguments
+180:   CALL  6,-177(7) 	push return address and jump
+181:     LD  3,-1(4) 	restore register variable
+182:     LD  2,-2(4) 	restore register variable
+* <- call function output end
+* <- compound 20 end
+183:    LDA  7,1(7) 	jmp to end
+* -> assign to k
+* -> generate code for rhs in place
+* -> Op
+184:    LDA  2,1(2) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- if end
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+185:    LDA  3,4(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 20 end
+* while : body end
+* while : test expression start
+* -> condition
+186:    LDA  0,-40(3) 	condition: compare
+* <- condition
+187:    JLT  0,-62(7) 	while : true
+* while : test expression end
+* -> call function output
+188:     ST  2,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+189:    LDA  6,-1(6) 	stack growth after push arguments
+190:   CALL  6,-187(7) 	push return address and jump
+* <- call function output end
+* -> assign to i
+* -> generate code for rhs in place
+* -> const 7
+191:    LDC  3,7(0) 	load const
+* <- Const end
+* <- generate code for rhs end
+* <- assign
+* -> while start
+* -> condition
+192:    LDA  0,-3(3) 	condition: compare
+* <- condition
+193:    JGE  0,8(7) 	while : false
+* -> compound 23 start
+* -> call function output
+* -> const 999
+194:    LDC  0,999(0) 	load const
+* <- Const end
+195:     ST  0,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+196:     ST  3,-1(4) 	save register variable
+197:    LDA  6,-1(6) 	stack growth after push arguments
+198:   CALL  6,-195(7) 	push return address and jump
+199:     LD  3,-1(4) 	restore register variable
+* <- call function output end
+* -> assign to i
+* -> generate code for rhs in place
+* -> Op
+200:    LDA  3,1(3) 	op +/- const
+* <- Op
+* <- generate code for rhs end
+* <- assign
+* <- compound 23 end
+201:    LDA  7,-10(7) 	while : jump to test
+* <- while end
+* -> call function output
+202:     ST  3,-1(6) 	op: push argument(reverse order)
+* 1 arguments are pushed
+203:    LDA  6,-1(6) 	stack growth after push arguments
+204:   CALL  6,-201(7) 	push return address and jump
+* <- call function output end
+* <- compound 25 end
+205:  LEAVE  4,0(6) 	return: pop frame and fp
+206:    RET  6,0(0) 	return and pop arguments
+* <- function declaration main end
@@ -0,0 +1,74 @@
+#!/bin/sh
+# Regression tests for the C- compiler. Each test/<name>.cm that has
+# an expected output test/<name>.out is compiled in each mode below
+# and run with test/<name>.in as its input, if there is one. What it
+# writes must match test/<name>.out. The last modes are the profile
+# round trips: a -fprofile-generate build is run on tm, or by
+# --run, to write the profile, and a -fprofile-use build reads it
+# back. An _ in a mode separates its flags. test/<name>.flags, if
+# there is one, holds flags added in every mode. Each line of
+# test/<name>.trace, if there is one, must be among the lines that
+# -O2 -fno-inline -ftrace-optimize reports.
+
+cd "$(dirname "$0")" || exit 1
+CMINUS=../cminus
+TM=../tm
+OUT=out
+MODES="-O0 -O1 -O2 -fir -O1_-fir --target=x86-64 -O1_--target=x86-64"
+
+mkdir -p $OUT
+passed=0
+failed=0
+
+# check name mode: compares out/name.run with name.out
+check()
+{ if cmp -s $OUT/$1.run $1.out
+  then passed=$((passed + 1))
+  else failed=$((failed + 1))
+       echo "FAIL: $1 $2"
+  fi
+}
+
+# runTM file input: runs file on tm with input and prints what it
+# writes
+runTM()
+{ (echo g; cat $2; echo q) | $TM $1 | sed -n 's/.*OUT instruction prints: //p'
+}
+
+for src in *.cm
+do name=${src%.cm}
+   [ -f $name.out ] || continue
+   input=/dev/null
+   [ -f $name.in ] && input=$name.in
+   extra=
+   [ -f $name.flags ] && extra=$(cat $name.flags)
+   cp $src $OUT/$src
+   for mode in $MODES
+   do flags="$(echo $mode | tr _ ' ') $extra"
+      $CMINUS $flags --run $OUT/$src < $input > $OUT/$name.run 2> $OUT/$name.lst
+      check $name "$flags"
+   done
+   rm -f $OUT/$name.prof
+   $CMINUS $extra -fprofile-generate $OUT/$src > $OUT/$name.lst 2>&1 &&
+     runTM $OUT/$name.tm $input > /dev/null &&
+     $CMINUS $extra -fprofile-use $OUT/$src > $OUT/$name.lst 2>&1 &&
+     runTM $OUT/$name.tm $input > $OUT/$name.run
+   [ -f $OUT/$name.prof ] || echo "no profile written" > $OUT/$name.run
+   check $name -fprofile-use
+   rm -f $OUT/$name.prof
+   $CMINUS $extra --run -fprofile-generate $OUT/$src < $input > /dev/null 2> $OUT/$name.lst &&
+     $CMINUS $extra --run -fprofile-use $OUT/$src < $input > $OUT/$name.run 2> $OUT/$name.lst
+   [ -f $OUT/$name.prof ] || echo "no profile written" > $OUT/$name.run
+   check $name "--run -fprofile-use"
+   [ -f $name.trace ] || continue
+   $CMINUS $extra -O2 -fno-inline -ftrace-optimize $OUT/$src > $OUT/$name.lst 2>&1
+   if grep -Fxvf $OUT/$name.lst $name.trace > $OUT/$name.run
+   then failed=$((failed + 1))
+        echo "FAIL: $name -ftrace-optimize"
+        sed 's/^/  missing:/' $OUT/$name.run
+   else passed=$((passed + 1))
+   fi
+done
+
+echo "$passed passed, $failed failed"
+[ $failed -eq 0 ]
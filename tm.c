@@ -43,6 +43,7 @@ typedef enum {
    opSUB,    /* RR     reg(r) = reg(s)-reg(t) */
    opMUL,    /* RR     reg(r) = reg(s)*reg(t) */
    opDIV,    /* RR     reg(r) = reg(s)/reg(t) */
+   opMOD,    /* RR     reg(r) = reg(s)%reg(t) */
    opRRLim,   /* limit of RR opcodes */
 
    /* RM instructions */
@@ -59,6 +60,13 @@ typedef enum {
    opJGE,     /* RA     if reg(r)>=0 then reg(7) = d+reg(s) */
    opJEQ,     /* RA     if reg(r)==0 then reg(7) = d+reg(s) */
    opJNE,     /* RA     if reg(r)!=0 then reg(7) = d+reg(s) */
+   opSHL,     /* RA     reg(r) = reg(s) << d */
+   opSHR,     /* RA     reg(r) = reg(s) >> d (arithmetic) */
+   opCALL,    /* RA     reg(r)--; mem(reg(r)) = reg(7); reg(7) = d+reg(s) */
+   opRET,     /* RA     reg(7) = mem(reg(r)); reg(r) = reg(r)+d+1 */
+   opENTER,   /* RA     reg(s)--; mem(reg(s)) = reg(r); reg(r) = reg(s);
+                        reg(s) = reg(s)-d */
+   opLEAVE,   /* RA     reg(s) = reg(r); reg(r) = mem(reg(s)); reg(s)++ */
    opRALim    /* Limit of RA opcodes */
    } OPCODE;
 
@@ -70,6 +78,13 @@ typedef enum {
    srZERODIVIDE
    } STEPRESULT;
 
+typedef enum {
+   prNONE,        /* no probe */
+   prBRANCHFALSE, /* branch taken when its condition fails */
+   prBRANCHTRUE,  /* branch taken when its condition holds */
+   prCALL         /* call site */
+   } PROBEKIND;
+
 typedef struct {
       int iop  ;
       int iarg1  ;
@@ -87,11 +102,23 @@ INSTRUCTION iMem [IADDR_SIZE];
 int dMem [DADDR_SIZE];
 int reg [NO_REGS];
 
+/* the probes the compiler placed with *@ lines:
+   what each instruction counts, the function and
+   line (and callee) it is counted for, and the
+   times it ran and jumped */
+int probeKind [IADDR_SIZE];
+char * probeKey [IADDR_SIZE];
+long probeCount [IADDR_SIZE];
+long probeTaken [IADDR_SIZE];
+int probes = 0;
+char probeLine[LINESIZE];
+
 char * opCodeTab[]
-        = {"HALT","IN","OUT","ADD","SUB","MUL","DIV","????",
+        = {"HALT","IN","OUT","ADD","SUB","MUL","DIV","MOD","????",
             /* RR opcodes */
            "LD","ST","????", /* RM opcodes */
-           "LDA","LDC","JLT","JLE","JGT","JGE","JEQ","JNE","????"
+           "LDA","LDC","JLT","JLE","JGT","JGE","JEQ","JNE",
+           "SHL","SHR","CALL","RET","ENTER","LEAVE","????"
            /* RA opcodes */
           };
 
@@ -100,7 +127,7 @@ char * stepResultTab[]
            "Data Memory Fault","Division by 0"
           };
 
-char pgmName[20];
+char pgmName[LINESIZE];
 FILE *pgm  ;
 
 char in_Line[LINESIZE] ;
@@ -217,6 +244,29 @@ int error( char * msg, int lineNo, int instNo)
   return FALSE;
 } /* error */
 
+/********************************************/
+void attachProbe ( int loc, int op, int arg1 )
+{ char fn[LINESIZE], callee[LINESIZE], key[3*LINESIZE];
+  int line, sense;
+  int kind = prNONE;
+  if ( (sscanf(probeLine,"branch %s %d %s %d",fn,&line,callee,&sense) == 4)
+       && (op >= opJLT) && (op <= opJNE) )
+  { kind = sense ? prBRANCHTRUE : prBRANCHFALSE;
+    sprintf(key,"%s %d %s",fn,line,callee);
+  }
+  else if ( (sscanf(probeLine,"call %s %d %s",fn,&line,callee) == 3)
+            && ((op == opCALL) || ((op == opLDA) && (arg1 == PC_REG))) )
+  { kind = prCALL;
+    sprintf(key,"%s %d %s",fn,line,callee);
+  }
+  probeLine[0] = '\0';
+  if ( kind == prNONE ) return;
+  probeKind[loc] = kind;
+  probeKey[loc] = malloc(strlen(key) + 1);
+  strcpy(probeKey[loc],key);
+  probes++;
+} /* attachProbe */
+
 /********************************************/
 int readInstructions (void)
 { OPCODE op;
@@ -232,7 +282,11 @@ int readInstructions (void)
     iMem[loc].iarg1 = 0 ;
     iMem[loc].iarg2 = 0 ;
     iMem[loc].iarg3 = 0 ;
+    probeKind[loc] = prNONE ;
+    probeCount[loc] = 0 ;
+    probeTaken[loc] = 0 ;
   }
+  probeLine[0] = '\0' ;
   lineNo = 0 ;
   while (! feof(pgm))
   { fgets( in_Line, LINESIZE-2, pgm  ) ;
@@ -241,7 +295,10 @@ int readInstructions (void)
     lineLen = strlen(in_Line)-1 ;
     if (in_Line[lineLen]=='\n') in_Line[lineLen] = '\0' ;
     else in_Line[++lineLen] = '\0';
-    if ( (nonBlank()) && (in_Line[inCol] != '*') )
+    if ( (nonBlank()) && (in_Line[inCol] == '*')
+         && (in_Line[inCol+1] == '@') )
+      strcpy(probeLine, in_Line + inCol + 2) ;
+    else if ( (nonBlank()) && (in_Line[inCol] != '*') )
     { if (! getNum())
         return error("Bad location", lineNo,-1);
       loc = num;
@@ -297,6 +354,8 @@ int readInstructions (void)
       iMem[loc].iarg1 = arg1;
       iMem[loc].iarg2 = arg2;
       iMem[loc].iarg3 = arg3;
+      if ( probeLine[0] != '\0' )
+        attachProbe(loc, op, arg1);
     }
   }
   return TRUE;
@@ -377,6 +436,12 @@ STEPRESULT stepTM (void)
       else return srZERODIVIDE ;
       break;
 
+    case opMOD :
+    /***********************************/
+      if ( reg[t] != 0 ) reg[r] = reg[s] % reg[t];
+      else return srZERODIVIDE ;
+      break;
+
     /*************** RM instructions ********************/
     case opLD :    reg[r] = dMem[m] ;  break;
     case opST :    dMem[m] = reg[r] ;  break;
@@ -391,8 +456,47 @@ STEPRESULT stepTM (void)
     case opJEQ :    if ( reg[r] == 0 ) reg[PC_REG] = m ; break;
     case opJNE :    if ( reg[r] != 0 ) reg[PC_REG] = m ; break;
 
+    case opSHL :
+      reg[r] = (int) ((unsigned) reg[s] << (currentinstruction.iarg2 & 31)) ;
+      break;
+    case opSHR :    reg[r] = reg[s] >> (currentinstruction.iarg2 & 31) ; break;
+
+    /*************** call and frame instructions ********/
+    case opCALL :
+      if ( (reg[r] <= 0) || (reg[r] > DADDR_SIZE) )
+         return srDMEM_ERR ;
+      dMem[--reg[r]] = reg[PC_REG] ;
+      reg[PC_REG] = m ;
+      break;
+
+    case opRET :
+      if ( (reg[r] < 0) || (reg[r] >= DADDR_SIZE) )
+         return srDMEM_ERR ;
+      reg[PC_REG] = dMem[reg[r]] ;
+      reg[r] = reg[r] + currentinstruction.iarg2 + 1 ;
+      break;
+
+    case opENTER :
+      if ( (reg[s] <= 0) || (reg[s] > DADDR_SIZE) )
+         return srDMEM_ERR ;
+      dMem[--reg[s]] = reg[r] ;
+      reg[r] = reg[s] ;
+      reg[s] = reg[s] - currentinstruction.iarg2 ;
+      break;
+
+    case opLEAVE :
+      if ( (reg[r] < 0) || (reg[r] >= DADDR_SIZE) )
+         return srDMEM_ERR ;
+      reg[s] = reg[r] ;
+      reg[r] = dMem[reg[s]++] ;
+      break;
+
     /* end of legal instructions */
   } /* case */
+  if ( probeKind[pc] != prNONE )
+  { probeCount[pc]++ ;
+    if ( reg[PC_REG] != pc + 1 ) probeTaken[pc]++ ;
+  }
   return srOKAY ;
 } /* stepTM */
 
@@ -553,6 +657,40 @@ int doCommand (void)
 } /* doCommand */
 
 
+/********************************************/
+void writeProfile (void)
+{ char profName[LINESIZE+8];
+  FILE * prof;
+  long yes;
+  int loc;
+  char * dot;
+  strcpy(profName,pgmName) ;
+  dot = strrchr(profName,'.') ;
+  if ( (dot != NULL) && (strchr(dot,'/') == NULL) ) *dot = '\0' ;
+  strcat(profName,".prof") ;
+  prof = fopen(profName,"w") ;
+  if (prof == NULL)
+  { printf("Unable to write profile %s\n",profName);
+    return;
+  }
+  fprintf(prof,"* TM profile of %s\n",pgmName) ;
+  for (loc = 0 ; loc < IADDR_SIZE ; loc++)
+    switch ( probeKind[loc] )
+    { case prBRANCHFALSE :
+      case prBRANCHTRUE :
+        yes = probeKind[loc] == prBRANCHTRUE ? probeTaken[loc]
+              : probeCount[loc] - probeTaken[loc] ;
+        fprintf(prof,"branch %s %ld %ld\n",probeKey[loc],
+                yes,probeCount[loc] - yes) ;
+        break;
+      case prCALL :
+        fprintf(prof,"call %s %ld\n",probeKey[loc],probeCount[loc]) ;
+        break;
+    }
+  fclose(prof) ;
+  printf("Profile written to %s\n",profName);
+} /* writeProfile */
+
 /********************************************/
 /* E X E C U T I O N   B E G I N S   H E R E */
 /********************************************/
@@ -582,5 +720,7 @@ main( int argc, char * argv[] )
      done = ! doCommand ();
   while (! done );
   printf("Simulation done.\n");
+  if ( probes > 0 )
+    writeProfile();
   return 0;
 }
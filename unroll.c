@@ -0,0 +1,277 @@
+/****************************************************/
+/* File: unroll.c                                   */
+/* Loop unrolling for the C- compiler: a counted    */
+/* loop is replaced by copies of its body when its  */
+/* iterations fit the size budget, and otherwise by */
+/* a loop over unrollFactor copies followed by the  */
+/* original loop for the remaining iterations       */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "fold.h"
+#include "profile.h"
+#include "unroll.h"
+
+/* the most copies of a body a loop is unrolled
+   into when not unrolled fully */
+static int unrollFactor = UNROLLFACTOR;
+
+/* counts for the report */
+static int full;
+static int partial;
+static int remainders;
+
+/* Function hasDecls returns TRUE if tree t or its
+ * siblings declare a local, which the copies of a
+ * body could not share
+ */
+static int hasDecls(TreeNode * t)
+{ int i;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK
+        && (t->kind.exp == VarK || t->kind.exp == VarArrayK))
+      return TRUE;
+    for (i = 0; i < MAXCHILDREN; i++)
+      if (hasDecls(t->child[i]))
+        return TRUE;
+  }
+  return FALSE;
+}
+
+/* Function copyTree returns a copy of tree t and
+ * its siblings with each use of the scalar iv
+ * replaced by iv + delta, or by the constant
+ * delta if absolute is TRUE
+ */
+static TreeNode * copyTree(TreeNode * t, Symbol * iv, int delta,
+                           int absolute)
+{ TreeNode * n;
+  int i;
+  if (t == NULL)
+    return NULL;
+  if (t->nodekind == ExpK && t->kind.exp == IdK && t->sym == iv)
+  { if (absolute)
+      n = newConst(delta, t->lineno);
+    else if (delta == 0)
+      n = newId(iv, t->lineno);
+    else
+      n = newOp(PLUS, newId(iv, t->lineno), newConst(delta, t->lineno));
+  }
+  else
+  { n = (TreeNode *) malloc(sizeof(TreeNode));
+    *n = *t;
+    for (i = 0; i < MAXCHILDREN; i++)
+      n->child[i] = copyTree(t->child[i], iv, delta, absolute);
+  }
+  n->sibling = copyTree(t->sibling, iv, delta, absolute);
+  return n;
+}
+
+/* Function append links list b after list a and
+ * returns the joined list
+ */
+static TreeNode * append(TreeNode * a, TreeNode * b)
+{ TreeNode * t = a;
+  if (a == NULL)
+    return b;
+  while (t->sibling != NULL)
+    t = t->sibling;
+  t->sibling = b;
+  return a;
+}
+
+/* Function stepOf returns TRUE if statement t is
+ * iv = iv + c or iv = iv - c, setting c
+ */
+static int stepOf(TreeNode * t, Symbol * iv, int * c)
+{ TreeNode * e;
+  if (t->nodekind != ExpK || t->kind.exp != AssignK
+      || t->child[0]->kind.exp != IdK || t->child[0]->sym != iv)
+    return FALSE;
+  e = t->child[1];
+  if (e->kind.exp != OpK || (e->attr.op != PLUS && e->attr.op != MINUS)
+      || e->child[0]->kind.exp != IdK || e->child[0]->sym != iv
+      || e->child[1]->kind.exp != ConstK)
+    return FALSE;
+  *c = e->attr.op == PLUS ? e->child[1]->attr.val : -e->child[1]->attr.val;
+  return *c != 0;
+}
+
+/* Function tripCount returns the number of times
+ * the test iv rel bound holds for iv stepped by c
+ * from start, running it as the TM would, or -1
+ * if that is more than MAXTRIPS
+ */
+static int tripCount(TokenType rel, int start, int bound, int c)
+{ int n, v = start, holds;
+  for (n = 0; n <= MAXTRIPS; n++)
+  { if (!evaluate(rel, v, bound, &holds) || !holds)
+      return n;
+    evaluate(PLUS, v, c, &v);
+  }
+  return -1;
+}
+
+/* Function isCold returns TRUE if the profile has
+ * the body of while loop t run too seldom to be
+ * worth the code unrolling adds
+ */
+static int isCold(TreeNode * t)
+{ int yes, no;
+  char text[64];
+  if (!ProfileUse || !branchCount(t, &yes, &no) || isHot(yes))
+    return FALSE;
+  sprintf(text, "loop not unrolled, body ran %d times", yes);
+  profileDecision(t->lineno, text);
+  return TRUE;
+}
+
+/* Procedure unroll unrolls while loop t if it is
+ * counted and its variable was last set by init
+ */
+static void unroll(TreeNode * t, TreeNode * init)
+{ TreeNode * test = t->child[0], * body = t->child[1];
+  TreeNode * stmts, * prev, * step, * copies, * w;
+  Symbol * iv;
+  int c, n, size, factor, start, j;
+  if (test->kind.exp != OpK || !isRelation(test->attr.op)
+      || test->child[0]->kind.exp != IdK
+      || test->child[1]->kind.exp != ConstK)
+    return;
+  iv = test->child[0]->sym;
+  if (iv->storage == GlobalS || init->child[1]->kind.exp != ConstK
+      || body == NULL || body->nodekind != StmtK
+      || body->kind.stmt != CompoundK || body->child[0] != NULL
+      || body->child[1] == NULL || hasDecls(body->child[1]))
+    return;
+  /* the step must end the body and be the only
+     assignment to the variable */
+  stmts = body->child[1];
+  for (prev = stmts; prev->sibling != NULL && prev->sibling->sibling != NULL;
+       prev = prev->sibling)
+    ;
+  step = prev->sibling;
+  if (step == NULL || !stepOf(step, iv, &c) || countAssigns(stmts, iv) != 1)
+    return;
+  start = init->child[1]->attr.val;
+  n = tripCount(test->attr.op, start, test->child[1]->attr.val, c);
+  if (n <= 0)
+    return;
+  size = countNodes(stmts) - countNodes(step);
+  if (n * size <= UNROLLSIZE)
+    factor = n;
+  else
+  { factor = unrollFactor;
+    while (factor > 1 && factor * size > UNROLLSIZE)
+      factor--;
+    if (factor < 2 || factor > n)
+      return;
+  }
+  /* one copy of the body is no larger than the
+     loop, so only more wait for the profile */
+  if (n > 1 && isCold(t))
+    return;
+  /* copy j of the body uses the variable plus
+     j steps, or its value on iteration j if the
+     loop goes away */
+  prev->sibling = NULL;
+  copies = NULL;
+  for (j = 0; j < factor; j++)
+    copies = append(copies, factor == n
+                            ? copyTree(stmts, iv, start + j * c, TRUE)
+                            : copyTree(stmts, iv, j * c, FALSE));
+  prev->sibling = step;
+  if (factor == n)
+  { /* leave the variable as the loop would */
+    append(copies, newAssign(iv, newConst(start + n * c, step->lineno)));
+    t->kind.stmt = CompoundK;
+    t->child[0] = NULL;
+    t->child[1] = copies;
+    full++;
+    return;
+  }
+  append(copies, newAssign(iv, newOp(PLUS, newId(iv, step->lineno),
+                                   newConst(factor * c, step->lineno))));
+  if (n % factor != 0)
+  { /* the original loop runs the iterations left */
+    w = (TreeNode *) malloc(sizeof(TreeNode));
+    *w = *t;
+    t->sibling = w;
+    remainders++;
+  }
+  t->child[0] = newOp(c > 0 ? LT : GT, newId(iv, test->lineno),
+                      newConst(start + n / factor * factor * c, test->lineno));
+  t->child[1] = newStmtNode(CompoundK);
+  t->child[1]->lineno = body->lineno;
+  t->child[1]->child[1] = copies;
+  partial++;
+}
+
+/* Function findInit returns the statement of
+ * list that sets scalar iv before statement t
+ * reaches it, or NULL if that is not one
+ * statement of the list assigning it
+ */
+static TreeNode * findInit(TreeNode * list, TreeNode * t, Symbol * iv)
+{ TreeNode * init = NULL;
+  int i;
+  for (; list != t; list = list->sibling)
+    if (list->nodekind == ExpK && list->kind.exp == AssignK
+        && list->child[0]->kind.exp == IdK && list->child[0]->sym == iv)
+      init = list;
+    else
+      for (i = 0; i < MAXCHILDREN; i++)
+        if (countAssigns(list->child[i], iv) > 0)
+          init = NULL;
+  return init;
+}
+
+/* Procedure unrollStmts unrolls the counted loops
+ * of a statement list, inner loops first
+ */
+static void unrollStmts(TreeNode * list)
+{ TreeNode * t, * test, * init;
+  int i;
+  for (t = list; t != NULL; t = t->sibling)
+  { if (t->nodekind != StmtK)
+      continue;
+    for (i = 0; i < MAXCHILDREN; i++)
+      unrollStmts(t->child[i]);
+    if (t->kind.stmt != WhileK)
+      continue;
+    test = t->child[0];
+    if (test->nodekind == ExpK && test->kind.exp == OpK
+        && test->child[0]->kind.exp == IdK
+        && (init = findInit(list, t, test->child[0]->sym)) != NULL)
+      unroll(t, init);
+  }
+}
+
+/* Procedure setUnrollFactor makes counted loops
+ * too large to unroll fully be unrolled into up
+ * to factor copies, as -funroll-factor=<n> asks
+ */
+void setUnrollFactor(int factor)
+{ unrollFactor = factor;
+}
+
+/* Procedure unrollLoops unrolls the counted loops
+ * of the syntax tree: those whose variable starts
+ * at a constant, is compared with a constant and
+ * is stepped by a constant
+ */
+void unrollLoops(TreeNode * syntaxTree)
+{ TreeNode * t;
+  full = 0;
+  partial = 0;
+  remainders = 0;
+  for (t = syntaxTree; t != NULL; t = t->sibling)
+    if (t->nodekind == StmtK && t->kind.stmt == FunctionK
+        && t->child[1] != NULL)
+      unrollStmts(t->child[1]);
+  if (TraceOptimize)
+    fprintf(listing, "\nUnrolling:\n  %d loops unrolled fully, %d by up to "
+            "%d with %d remainder loops\n",
+            full, partial, unrollFactor, remainders);
+}
@@ -0,0 +1,44 @@
+/****************************************************/
+/* File: unroll.h                                   */
+/* Loop unrolling for the C- compiler               */
+/****************************************************/
+
+#ifndef _UNROLL_H_
+#define _UNROLL_H_
+
+/* UNROLLFACTOR is the number of copies of the body
+ * a counted loop is unrolled into unless
+ * -funroll-factor=<n> says otherwise
+ */
+#define UNROLLFACTOR 4
+
+/* MAXFACTOR is the largest factor
+ * -funroll-factor=<n> may ask for
+ */
+#define MAXFACTOR 16
+
+/* UNROLLSIZE is the largest number of syntax tree
+ * nodes the copies of a loop body may take; a loop
+ * whose every iteration fits is unrolled fully
+ */
+#define UNROLLSIZE 200
+
+/* MAXTRIPS is the largest trip count a loop is
+ * counted to
+ */
+#define MAXTRIPS 100000
+
+/* Procedure setUnrollFactor makes counted loops
+ * too large to unroll fully be unrolled into up
+ * to factor copies, as -funroll-factor=<n> asks
+ */
+void setUnrollFactor(int factor);
+
+/* Procedure unrollLoops unrolls the counted loops
+ * of the syntax tree: those whose variable starts
+ * at a constant, is compared with a constant and
+ * is stepped by a constant
+ */
+void unrollLoops(TreeNode * syntaxTree);
+
+#endif
@@ -74,6 +74,7 @@ TreeNode * newStmtNode(StmtKind kind)
     t->nodekind = StmtK;
     t->kind.stmt = kind;
     t->lineno = lineno;
+    t->sym = NULL;
   }
   return t;
 }
@@ -92,6 +93,7 @@ TreeNode * newExpNode(ExpKind kind)
     t->nodekind = ExpK;
     t->kind.exp = kind;
     t->lineno = lineno;
+    t->sym = NULL;
     t->type = Void;
   }
   return t;
@@ -112,6 +114,160 @@ char * copyString(char * s)
   return t;
 }
 
+/* the pseudo array addresses are loaded through */
+Symbol memory = { "mem", GlobalS, 0, 1 };
+
+/* Function newConst returns the constant val */
+TreeNode * newConst(int val, int lineno)
+{ TreeNode * t = newExpNode(ConstK);
+  t->type = Integer;
+  t->lineno = lineno;
+  t->attr.val = val;
+  return t;
+}
+
+/* Function newId returns a reference to the
+ * scalar with symbol sym
+ */
+TreeNode * newId(Symbol * sym, int lineno)
+{ TreeNode * t = newExpNode(IdK);
+  t->type = Integer;
+  t->lineno = lineno;
+  t->attr.name = sym->name;
+  t->sym = sym;
+  return t;
+}
+
+/* Function newOp returns the expression a op b */
+TreeNode * newOp(TokenType op, TreeNode * a, TreeNode * b)
+{ TreeNode * t = newExpNode(OpK);
+  t->type = Integer;
+  t->lineno = a->lineno;
+  t->attr.op = op;
+  t->child[0] = a;
+  t->child[1] = b;
+  return t;
+}
+
+/* Function newAssign returns the statement
+ * sym = value
+ */
+TreeNode * newAssign(Symbol * sym, TreeNode * value)
+{ TreeNode * t = newExpNode(AssignK);
+  t->type = Integer;
+  t->lineno = value->lineno;
+  t->child[0] = newId(sym, value->lineno);
+  t->child[1] = value;
+  return t;
+}
+
+/* Function sameExp returns TRUE if the two
+ * expressions are side-effect free and always
+ * compute the same value
+ */
+int sameExp(TreeNode * a, TreeNode * b)
+{ if (a == NULL || b == NULL)
+    return a == b;
+  if (a->nodekind != ExpK || b->nodekind != ExpK
+      || a->kind.exp != b->kind.exp)
+    return FALSE;
+  switch (a->kind.exp)
+  { case ConstK:
+      return a->attr.val == b->attr.val;
+    case IdK:
+      return a->sym == b->sym;
+    case IdArrayK:
+      return a->sym == b->sym && sameExp(a->child[0], b->child[0]);
+    case OpK:
+      return a->attr.op == b->attr.op
+             && sameExp(a->child[0], b->child[0])
+             && sameExp(a->child[1], b->child[1]);
+    default:
+      return FALSE;
+  }
+}
+
+/* Function isModulo recognises a-a/b*b and
+ * a-b*(a/b), which cgen computes with one MOD,
+ * and returns the operands in a and b
+ */
+int isModulo(TreeNode * tree, TreeNode ** a, TreeNode ** b)
+{ TreeNode * m, * q, * d;
+  if (tree->nodekind != ExpK || tree->kind.exp != OpK
+      || tree->attr.op != MINUS)
+    return FALSE;
+  m = tree->child[1];
+  if (m->nodekind != ExpK || m->kind.exp != OpK || m->attr.op != TIMES)
+    return FALSE;
+  q = m->child[0];
+  d = m->child[1];
+  if (q->kind.exp != OpK || q->attr.op != OVER)
+  { q = m->child[1];
+    d = m->child[0];
+  }
+  if (q->kind.exp != OpK || q->attr.op != OVER)
+    return FALSE;
+  if (!sameExp(tree->child[0], q->child[0]) || !sameExp(q->child[1], d))
+    return FALSE;
+  *a = q->child[0];
+  *b = q->child[1];
+  return TRUE;
+}
+
+/* Function countNodes returns the number of nodes
+ * of tree t and its siblings
+ */
+int countNodes(TreeNode * t)
+{ int i, n = 0;
+  for (; t != NULL; t = t->sibling)
+  { n++;
+    for (i = 0; i < MAXCHILDREN; i++)
+      n += countNodes(t->child[i]);
+  }
+  return n;
+}
+
+/* Function hasCall returns TRUE if tree t has a
+ * call, not counting its siblings
+ */
+int hasCall(TreeNode * t)
+{ TreeNode * p;
+  int i;
+  if (t == NULL)
+    return FALSE;
+  if (t->nodekind == ExpK && t->kind.exp == CallK)
+    return TRUE;
+  for (i = 0; i < MAXCHILDREN; i++)
+    for (p = t->child[i]; p != NULL; p = p->sibling)
+      if (hasCall(p))
+        return TRUE;
+  return FALSE;
+}
+
+/* Function countAssigns returns the number of
+ * assignments to the scalar with symbol sym in
+ * tree t and its siblings
+ */
+int countAssigns(TreeNode * t, Symbol * sym)
+{ int i, n = 0;
+  for (; t != NULL; t = t->sibling)
+  { if (t->nodekind == ExpK && t->kind.exp == AssignK
+        && t->child[0]->kind.exp == IdK && t->child[0]->sym == sym)
+      n++;
+    for (i = 0; i < MAXCHILDREN; i++)
+      n += countAssigns(t->child[i], sym);
+  }
+  return n;
+}
+
+/* Function isRelation returns TRUE for the
+ * comparison operators
+ */
+int isRelation(TokenType op)
+{ return op == LT || op == LE || op == GT || op == GE
+         || op == EQ || op == NE;
+}
+
 /* Variable indentno is used by printTree to
  * store current number of spaces to indent
  */
@@ -28,6 +28,61 @@ TreeNode * newExpNode(ExpKind);
  */
 char * copyString( char * );
 
+/* An address kept in a local is dereferenced as
+ * an element of the pseudo array memory, a global
+ * at address 0: cgen loads mem[p] with LD 0(p)
+ */
+extern Symbol memory;
+
+/* Function newConst returns the constant val */
+TreeNode * newConst(int val, int lineno);
+
+/* Function newId returns a reference to the
+ * scalar with symbol sym
+ */
+TreeNode * newId(Symbol * sym, int lineno);
+
+/* Function newOp returns the expression a op b */
+TreeNode * newOp(TokenType op, TreeNode * a, TreeNode * b);
+
+/* Function newAssign returns the statement
+ * sym = value
+ */
+TreeNode * newAssign(Symbol * sym, TreeNode * value);
+
+/* Function sameExp returns TRUE if the two
+ * expressions are side-effect free and always
+ * compute the same value
+ */
+int sameExp(TreeNode * a, TreeNode * b);
+
+/* Function isModulo recognises a-a/b*b and
+ * a-b*(a/b), which cgen computes with one MOD,
+ * and returns the operands in a and b
+ */
+int isModulo(TreeNode * tree, TreeNode ** a, TreeNode ** b);
+
+/* Function countNodes returns the number of nodes
+ * of tree t and its siblings
+ */
+int countNodes(TreeNode * t);
+
+/* Function hasCall returns TRUE if tree t has a
+ * call, not counting its siblings
+ */
+int hasCall(TreeNode * t);
+
+/* Function countAssigns returns the number of
+ * assignments to the scalar with symbol sym in
+ * tree t and its siblings
+ */
+int countAssigns(TreeNode * t, Symbol * sym);
+
+/* Function isRelation returns TRUE for the
+ * comparison operators
+ */
+int isRelation(TokenType op);
+
 /* procedure printTree prints a syntax tree to the 
  * listing file using indentation to indicate subtrees
  */
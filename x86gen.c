@@ -0,0 +1,471 @@
+/****************************************************/
+/* File: x86gen.c                                   */
+/* x86-64 assembly generation from the IR for the   */
+/* C- compiler, for the System V calling convention */
+/* and gcc. Each virtual register has a home word   */
+/* in the frame below rbp; operands are loaded into */
+/* eax and ecx and results stored back. Arrays and  */
+/* globals live in a word memory addressed by word  */
+/* number from rbx, as TM data memory is, so array  */
+/* addresses stay C- integers: globals from word 0  */
+/* up, local arrays on a stack that r12 points to,  */
+/* growing down from the top                        */
+/****************************************************/
+
+#include "globals.h"
+#include "ir.h"
+#include "optimize.h"
+#include "x86gen.h"
+#include <stdarg.h>
+
+/* MEMSIZE is the number of words of the word
+   memory */
+#define MEMSIZE (1 << 20)
+
+/* ARGREGS is the number of arguments passed in
+   registers */
+#define ARGREGS 6
+
+static char * argReg[ARGREGS] =
+   { "%edi", "%esi", "%edx", "%ecx", "%r8d", "%r9d" };
+
+/* the function being generated, the rbp offset
+   of the home of each of its registers, and the
+   words its local arrays take on the array stack */
+static IrFunction * fn;
+static int * home;
+static int arrayWords;
+
+/* Procedure emit writes a line of assembly to the
+ * code file, as printf formats it
+ */
+static void emit(char * format, ...)
+{ va_list args;
+  va_start(args, format);
+  vfprintf(code, format, args);
+  va_end(args);
+  fprintf(code, "\n");
+}
+
+/* Procedure emitComment writes comment c to the
+ * code file if TraceCode is TRUE
+ */
+static void emitComment(char * c)
+{ if (TraceCode)
+    emit("# %s", c);
+}
+
+/* Function operand returns the assembly operand
+ * for value v, in a static buffer
+ */
+static char * operand(IrValue v)
+{ static char buffer[2][32];
+  static int which = 0;
+  which = !which;
+  if (v.kind == IrImm)
+    sprintf(buffer[which], "$%d", v.val);
+  else
+    sprintf(buffer[which], "%d(%%rbp)", home[v.val]);
+  return buffer[which];
+}
+
+/* Procedure load puts value v in the 32-bit
+ * register r
+ */
+static void load(IrValue v, char * r)
+{ emit("\tmovl\t%s, %s", operand(v), r);
+}
+
+/* Procedure store saves eax in the home of
+ * virtual register dst
+ */
+static void store(int dst)
+{ emit("\tmovl\t%%eax, %d(%%rbp)", home[dst]);
+}
+
+/* Function condition returns the x86 condition
+ * code for relation op, or for its inverse if
+ * sense is FALSE
+ */
+static char * condition(TokenType op, int sense)
+{ if (!sense)
+    switch (op)
+    { case LT: op = GE; break;
+      case LE: op = GT; break;
+      case GT: op = LE; break;
+      case GE: op = LT; break;
+      case EQ: op = NE; break;
+      default: op = EQ; break;
+    }
+  switch (op)
+  { case LT: return "l";
+    case LE: return "le";
+    case GT: return "g";
+    case GE: return "ge";
+    case EQ: return "e";
+    default: return "ne";
+  }
+}
+
+/* Procedure genDifference sets the flags by the
+ * sign of a - b, as TM jumps on it, so that a
+ * comparison whose difference wraps around comes
+ * out as it does on TM
+ */
+static void genDifference(IrValue a, IrValue b)
+{ load(a, "%eax");
+  if (b.kind != IrImm || b.val != 0)
+    emit("\tsubl\t%s, %%eax", operand(b));
+  emit("\ttestl\t%%eax, %%eax");
+}
+
+/* Procedure genBinary generates dst = a oper b */
+static void genBinary(IrInstr * i)
+{ switch (i->oper)
+  { case PLUS:
+      load(i->a, "%eax");
+      emit("\taddl\t%s, %%eax", operand(i->b));
+      break;
+    case MINUS:
+      load(i->a, "%eax");
+      emit("\tsubl\t%s, %%eax", operand(i->b));
+      break;
+    case TIMES:
+      load(i->a, "%eax");
+      emit("\timull\t%s, %%eax", operand(i->b));
+      break;
+    case OVER:
+      load(i->a, "%eax");
+      load(i->b, "%ecx");
+      emit("\tcltd");
+      emit("\tidivl\t%%ecx");
+      break;
+    default:
+      /* a comparison as a value: 1 if it holds */
+      genDifference(i->a, i->b);
+      emit("\tset%s\t%%al", condition(i->oper, TRUE));
+      emit("\tmovzbl\t%%al, %%eax");
+      break;
+  }
+  store(i->dst);
+}
+
+/* Function address returns the operand for the
+ * word disp past base a in the word memory,
+ * loading a into rcx if it is present
+ */
+static char * address(IrValue a, int disp)
+{ static char buffer[32];
+  if (a.kind == IrNone)
+    sprintf(buffer, "%d(%%rbx)", 4 * disp);
+  else
+  { emit("\tmovslq\t%s, %%rcx", operand(a));
+    sprintf(buffer, "%d(%%rbx,%%rcx,4)", 4 * disp);
+  }
+  return buffer;
+}
+
+/* Procedure genArgs puts the arguments of call i
+ * in their registers, pushing those past the
+ * sixth last first, and returns the bytes pushed
+ */
+static int genArgs(IrInstr * i)
+{ int k, pushed = 0;
+  if (i->nargs > ARGREGS)
+  { pushed = 8 * (i->nargs - ARGREGS);
+    if (pushed % 16 != 0)
+    { emit("\tsubq\t$8, %%rsp");
+      pushed += 8;
+    }
+    for (k = i->nargs - 1; k >= ARGREGS; k--)
+    { load(i->args[k], "%eax");
+      emit("\tpushq\t%%rax");
+    }
+  }
+  for (k = 0; k < i->nargs && k < ARGREGS; k++)
+    load(i->args[k], argReg[k]);
+  return pushed;
+}
+
+/* Procedure genCall generates call i */
+static void genCall(IrInstr * i)
+{ int pushed = genArgs(i);
+  emit("\tcall\tcm_%s", i->sym->name);
+  if (pushed > 0)
+    emit("\taddq\t$%d, %%rsp", pushed);
+  if (i->dst >= 0)
+    store(i->dst);
+}
+
+/* Function isTailCall returns TRUE if tail calls
+ * are enabled and call i is followed by the return
+ * of its value, passes all its arguments in
+ * registers and passes no local array, which the
+ * return frees
+ */
+static int isTailCall(IrInstr * i)
+{ IrInstr * r = i->next;
+  return passEnabled("tail-calls") && r != NULL && r->op == IrReturn && i->dst >= 0
+         && r->a.kind == IrReg && r->a.val == i->dst
+         && i->nargs <= ARGREGS && !i->localArray;
+}
+
+/* Procedure genReturn pops the frame and the
+ * local arrays and returns. A tail call jumps to
+ * function sym instead
+ */
+static void genReturn(Symbol * sym)
+{ if (arrayWords > 0)
+    emit("\taddq\t$%d, %%r12", arrayWords);
+  emit("\tleave");
+  if (sym != NULL)
+    emit("\tjmp\tcm_%s", sym->name);
+  else
+    emit("\tret");
+}
+
+/* Procedure genInstr generates instruction i of
+ * block b
+ */
+static void genInstr(IrBlock * b, IrInstr * i)
+{ switch (i->op)
+  { case IrCopy:
+      load(i->a, "%eax");
+      store(i->dst);
+      break;
+    case IrBinary:
+      genBinary(i);
+      break;
+    case IrAddress:
+      if (i->sym->storage == GlobalS)
+        emit("\tmovl\t$%d, %%eax", i->sym->offset);
+      else
+        emit("\tleal\t%d(%%r12), %%eax", i->sym->offset);
+      store(i->dst);
+      break;
+    case IrLoad:
+      emit("\tmovl\t%s, %%eax", address(i->a, i->disp));
+      store(i->dst);
+      break;
+    case IrStore:
+      load(i->b, "%eax");
+      emit("\tmovl\t%%eax, %s", address(i->a, i->disp));
+      break;
+    case IrCall:
+      if (isTailCall(i))
+      { genArgs(i);
+        genReturn(i->sym);
+      }
+      else
+        genCall(i);
+      break;
+    case IrJump:
+      if (i->target[0] != b->next)
+        emit("\tjmp\t.L%s_%d", fn->name, i->target[0]->id);
+      break;
+    case IrBranch:
+      genDifference(i->a, i->b);
+      if (i->target[0] == b->next)
+        emit("\tj%s\t.L%s_%d", condition(i->oper, FALSE), fn->name,
+             i->target[1]->id);
+      else
+      { emit("\tj%s\t.L%s_%d", condition(i->oper, TRUE), fn->name,
+             i->target[0]->id);
+        if (i->target[1] != b->next)
+          emit("\tjmp\t.L%s_%d", fn->name, i->target[1]->id);
+      }
+      break;
+    case IrReturn:
+      if (i->a.kind != IrNone)
+        load(i->a, "%eax");
+      genReturn(NULL);
+      break;
+  }
+}
+
+/* Function layoutFrame gives each register used
+ * by function f its home below rbp, or above it
+ * for a parameter passed on the stack, and each
+ * local array its place on the array stack. It
+ * returns the bytes the frame takes below rbp
+ */
+static int layoutFrame(IrFunction * f)
+{ IrBlock * b;
+  IrInstr * i;
+  IrValue ** uses;
+  int r, n, k, slots = 0;
+  free(home);
+  home = (int *) malloc((f->nregs + 1) * sizeof(int));
+  for (r = 0; r < f->nregs; r++)
+    if (r >= ARGREGS && r < f->nparams)
+      home[r] = 16 + 8 * (r - ARGREGS);
+    else if (r < f->nparams)
+      home[r] = -4 * (++slots);
+    else
+      home[r] = 0;
+  for (b = f->entry; b != NULL; b = b->next)
+    for (i = b->first; i != NULL; i = i->next)
+    { uses = (IrValue **) malloc((2 + i->nargs) * sizeof(IrValue *));
+      for (n = usedValues(i, uses) - 1; n >= 0; n--)
+        if (uses[n]->kind == IrReg && home[uses[n]->val] == 0)
+          home[uses[n]->val] = -4 * (++slots);
+      free(uses);
+      r = definesReg(i);
+      if (r >= 0 && home[r] == 0)
+        home[r] = -4 * (++slots);
+    }
+  arrayWords = 0;
+  for (k = 0; k < f->narrays; k++)
+  { f->arrays[k]->offset = arrayWords;
+    arrayWords += f->arrays[k]->size;
+  }
+  return (4 * slots + 15) / 16 * 16;
+}
+
+/* Procedure genRuntime generates builtin f, input
+ * or output, as a call to scanf or to printf and
+ * fflush
+ */
+static void genRuntime(IrFunction * f)
+{ if (strcmp(f->name, "input") == 0)
+  { emit("\tsubq\t$24, %%rsp");
+    emit("\tleaq\t.Lformat_in(%%rip), %%rdi");
+    emit("\tleaq\t12(%%rsp), %%rsi");
+    emit("\txorl\t%%eax, %%eax");
+    emit("\tcall\tscanf@PLT");
+    emit("\tcmpl\t$1, %%eax");
+    emit("\tjne\t.Lbad_input");
+    emit("\tmovl\t12(%%rsp), %%eax");
+    emit("\taddq\t$24, %%rsp");
+    emit("\tret");
+    emit(".Lbad_input:");
+    emit("\tmovl\t$1, %%edi");
+    emit("\tcall\texit@PLT");
+  }
+  else
+  { emit("\tsubq\t$8, %%rsp");
+    emit("\tmovl\t%%edi, %%esi");
+    emit("\tleaq\t.Lformat_out(%%rip), %%rdi");
+    emit("\txorl\t%%eax, %%eax");
+    emit("\tcall\tprintf@PLT");
+    /* flush, so a fault later loses no output */
+    emit("\txorl\t%%edi, %%edi");
+    emit("\tcall\tfflush@PLT");
+    emit("\taddq\t$8, %%rsp");
+    emit("\tret");
+  }
+}
+
+/* Procedure genFunction generates function f */
+static void genFunction(IrFunction * f)
+{ IrBlock * b;
+  IrInstr * i;
+  char comment[128];
+  int k;
+  fn = f;
+  if (TraceCode)
+  { sprintf(comment, "-> function declaration %s", f->name);
+    emitComment(comment);
+  }
+  emit("\t.type\tcm_%s, @function", f->name);
+  emit("cm_%s:", f->name);
+  if (f->entry == NULL)
+    genRuntime(f);
+  else
+  { k = layoutFrame(f);
+    emit("\tpushq\t%%rbp");
+    emit("\tmovq\t%%rsp, %%rbp");
+    if (k > 0)
+      emit("\tsubq\t$%d, %%rsp", k);
+    for (k = 0; k < f->nparams && k < ARGREGS; k++)
+      emit("\tmovl\t%s, %d(%%rbp)", argReg[k], home[k]);
+    if (arrayWords > 0)
+      emit("\tsubq\t$%d, %%r12", arrayWords);
+    for (b = f->entry; b != NULL; b = b->next)
+    { emit(".L%s_%d:", f->name, b->id);
+      for (i = b->first; i != NULL; i = i->next)
+      { genInstr(b, i);
+        if (i->op == IrCall && isTailCall(i))
+          break;
+      }
+    }
+  }
+  if (TraceCode)
+  { sprintf(comment, "<- function declaration %s end", f->name);
+    emitComment(comment);
+  }
+}
+
+/* Procedure x86CodeGen generates x86-64 assembly
+ * for the functions of program to the code file,
+ * with a C main that sets up the word memory and
+ * calls the C- main. codefile names the file in a
+ * comment
+ */
+void x86CodeGen(IrFunction * program, char * codefile)
+{ IrFunction * f;
+  char * s = malloc(strlen(codefile) + 7);
+  strcpy(s, "File: ");
+  strcat(s, codefile);
+  emitComment("C- Compilation to x86-64 Code");
+  emitComment(s);
+  free(s);
+  emit("\t.section\t.rodata");
+  emit(".Lformat_in:");
+  emit("\t.string\t\"%%d\"");
+  emit(".Lformat_out:");
+  emit("\t.string\t\"%%d\\n\"");
+  emit("\t.bss");
+  emit("\t.align\t16");
+  emit("memory:");
+  emit("\t.zero\t%d", 4 * MEMSIZE);
+  emit("\t.text");
+  emitComment("Standard prelude:");
+  emit("\t.globl\tmain");
+  emit("\t.type\tmain, @function");
+  emit("main:");
+  emit("\tpushq\t%%rbx");
+  emit("\tpushq\t%%r12");
+  emit("\tpushq\t%%rbp");
+  emit("\tleaq\tmemory(%%rip), %%rbx");
+  emit("\tmovq\t$%d, %%r12", MEMSIZE);
+  emit("\tcall\tcm_main");
+  emit("\txorl\t%%eax, %%eax");
+  emit("\tpopq\t%%rbp");
+  emit("\tpopq\t%%r12");
+  emit("\tpopq\t%%rbx");
+  emit("\tret");
+  emitComment("End of standard prelude.");
+  for (f = program; f != NULL; f = f->next)
+    genFunction(f);
+  emit("\t.section\t.note.GNU-stack,\"\",@progbits");
+}
+
+/* Function assemble assembles and links the
+ * assembly in asmfile with gcc into the
+ * executable exefile, and returns TRUE if gcc
+ * succeeded
+ */
+int assemble(char * asmfile, char * exefile)
+{ char * command = malloc(strlen(asmfile) + strlen(exefile) + 32);
+  int status;
+  sprintf(command, "gcc -o '%s' '%s'", exefile, asmfile);
+  status = system(command);
+  free(command);
+  return status == 0;
+}
+
+/* Function runExecutable runs the executable
+ * exefile with the standard streams of the
+ * compiler, and returns TRUE if it exited with
+ * status 0
+ */
+int runExecutable(char * exefile)
+{ char * command = malloc(strlen(exefile) + 8);
+  int status;
+  sprintf(command, strchr(exefile, '/') != NULL ? "'%s'" : "'./%s'", exefile);
+  fflush(stdout);
+  status = system(command);
+  free(command);
+  return status == 0;
+}
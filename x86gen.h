@@ -0,0 +1,34 @@
+/****************************************************/
+/* File: x86gen.h                                   */
+/* x86-64 assembly generation from the IR           */
+/* for the C- compiler                              */
+/****************************************************/
+
+#ifndef _X86GEN_H_
+#define _X86GEN_H_
+
+#include "ir.h"
+
+/* Procedure x86CodeGen generates x86-64 assembly
+ * for the functions of program to the code file,
+ * with a C main that sets up the word memory and
+ * calls the C- main. codefile names the file in a
+ * comment
+ */
+void x86CodeGen(IrFunction * program, char * codefile);
+
+/* Function assemble assembles and links the
+ * assembly in asmfile with gcc into the
+ * executable exefile, and returns TRUE if gcc
+ * succeeded
+ */
+int assemble(char * asmfile, char * exefile);
+
+/* Function runExecutable runs the executable
+ * exefile with the standard streams of the
+ * compiler, and returns TRUE if it exited with
+ * status 0
+ */
+int runExecutable(char * exefile);
+
+#endif